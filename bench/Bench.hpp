@@ -0,0 +1,49 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <vector>
+
+struct BenchOptions {
+    // smallest size only and checks on, for running under ctest
+    bool quick = false;
+    std::vector<size_t> sizes;
+};
+
+inline int g_benchFailures = 0;
+
+#define BENCH_CHECK(cond) do { \
+    if (!(cond)) { \
+        std::fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+        g_benchFailures += 1; \
+    } \
+} while (0)
+
+// Runs `fn` until it has taken at least 200ms (or once in quick mode) and prints the average
+template <class F>
+void measure(BenchOptions const& options, std::string_view name, size_t items, F&& fn) {
+    using Clock = std::chrono::steady_clock;
+    auto minTime = options.quick ? Clock::duration::zero() : Clock::duration(std::chrono::milliseconds(200));
+
+    size_t runs = 0;
+    auto start = Clock::now();
+    auto elapsed = Clock::duration::zero();
+    do {
+        fn();
+        runs += 1;
+        elapsed = Clock::now() - start;
+    } while (elapsed < minTime);
+
+    auto perRun = std::chrono::duration<double, std::milli>(elapsed).count() / runs;
+    std::printf(
+        "%-48.*s %9zu items %10.3f ms/run %9.1f ns/item\n",
+        static_cast<int>(name.size()), name.data(), items, perRun,
+        items ? perRun * 1e6 / items : 0.0
+    );
+}
+
+void benchSearch(BenchOptions const& options);
+void benchLabels(BenchOptions const& options);
+void benchMemoryScan(BenchOptions const& options);
+void benchRender(BenchOptions const& options);
@@ -0,0 +1,204 @@
+#include "Bench.hpp"
+#include "../src/InspectionServer.hpp"
+#include "../src/NodeRegistry.hpp"
+#include <Geode/ui/OverlayManager.hpp>
+#include <Geode/utils/cocos.hpp>
+#include <fstream>
+#include <iterator>
+#include <memory>
+
+// Drives the inspection server through a LoopbackConnection, the way a client would over TCP
+
+using namespace geode::prelude;
+
+namespace {
+    // every message the server sent since the last call, one per line
+    std::vector<matjson::Value> receive(LoopbackConnection* connection) {
+        std::vector<matjson::Value> messages;
+        auto output = connection->take();
+        size_t start = 0;
+        while (start < output.size()) {
+            auto end = output.find('\n', start);
+            BENCH_CHECK(end != std::string::npos);
+            if (end == std::string::npos) break;
+            auto parsed = matjson::parse(std::string_view(output).substr(start, end - start));
+            BENCH_CHECK(parsed.isOk());
+            if (parsed) messages.push_back(std::move(parsed).unwrap());
+            start = end + 1;
+        }
+        return messages;
+    }
+
+    LoopbackConnection* connect(std::string line) {
+        auto connection = std::make_unique<LoopbackConnection>();
+        auto raw = connection.get();
+        raw->push(std::move(line));
+        InspectionServer::get()->addConnection(std::move(connection));
+        return raw;
+    }
+
+    matjson::Value const* findChange(std::vector<matjson::Value> const& messages, std::string_view op, uint64_t node) {
+        for (auto& message : messages) {
+            if (message["type"].asString().unwrapOr("") != "delta") continue;
+            auto& changes = message["changes"];
+            for (size_t i = 0; i < changes.size(); i++) {
+                auto& change = changes[i];
+                // additions are addressed by the parent they went under
+                auto key = op == "add" ? "parent" : "node";
+                if (change["op"].asString().unwrapOr("") == op && change[key].asInt().unwrapOr(0) == static_cast<intmax_t>(node)) {
+                    return &change;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    size_t countType(std::vector<matjson::Value> const& messages, std::string_view type) {
+        size_t count = 0;
+        for (auto& message : messages) {
+            if (message["type"].asString().unwrapOr("") == type) count += 1;
+        }
+        return count;
+    }
+}
+
+int main() {
+    auto server = InspectionServer::get();
+    auto registry = NodeRegistry::get();
+
+    auto scene = new CCScene();
+    auto a = new CCNode();
+    auto b = new CCNode();
+    auto c = new CCNodeRGBA();
+    auto e = new CCNode();
+    scene->addChild(a);
+    scene->addChild(b);
+    scene->addChild(e);
+    a->addChild(c);
+    c->setID("c");
+    CCDirector::get()->setRunningScene(scene);
+
+    BENCH_CHECK(server->writeToken());
+    std::ifstream tokenFile(InspectionServer::getTokenPath());
+    std::string token(std::istreambuf_iterator<char>(tokenFile), {});
+    BENCH_CHECK(token.size() == 32);
+
+    // a browser gets dropped without an answer
+    auto http = connect("POST /set HTTP/1.1");
+    // and so does anyone without the token
+    auto wrongToken = connect(R"({"type":"hello","token":"00000000000000000000000000000000"})");
+    auto client = connect(fmt::format(R"({{"type":"hello","token":"{}"}})", token));
+    client->push(R"({"type":"sync"})");
+    server->update();
+
+    BENCH_CHECK(!http->isOpen());
+    BENCH_CHECK(http->take().empty());
+    BENCH_CHECK(!wrongToken->isOpen());
+    BENCH_CHECK(countType(receive(wrongToken), "error") == 1);
+    BENCH_CHECK(client->isOpen());
+
+    auto messages = receive(client);
+    BENCH_CHECK(messages.size() == 2);
+    BENCH_CHECK(messages.size() > 0 && messages[0]["type"].asString().unwrapOr("") == "hello" && messages[0]["ok"].asBool().unwrapOr(false));
+    if (messages.size() == 2) {
+        // the scene and the overlay, with everything under them in depth first order
+        auto& tree = messages[1];
+        BENCH_CHECK(tree["type"].asString().unwrapOr("") == "tree");
+        BENCH_CHECK(tree["roots"].size() == 2);
+        BENCH_CHECK(tree["roots"][0].asInt().unwrapOr(0) == static_cast<intmax_t>(registry->identify(scene)));
+        auto& nodes = tree["nodes"];
+        BENCH_CHECK(nodes.size() == 6);
+        CCNode* order[] = { scene, a, c, b, e, OverlayManager::get() };
+        CCNode* parents[] = { nullptr, scene, a, scene, scene, nullptr };
+        for (size_t i = 0; i < std::min<size_t>(nodes.size(), 6); i++) {
+            BENCH_CHECK(nodes[i]["node"].asInt().unwrapOr(0) == static_cast<intmax_t>(registry->identify(order[i])));
+            BENCH_CHECK(nodes[i]["parent"].asInt().unwrapOr(-1) == static_cast<intmax_t>(registry->identify(parents[i])));
+        }
+        BENCH_CHECK(nodes[2]["id"].asString().unwrapOr("") == "c");
+        BENCH_CHECK(nodes[2]["class"].asString().unwrapOr("") == "cocos2d::CCNodeRGBA");
+    }
+    BENCH_CHECK(server->getClientCount() == 3);
+
+    // nothing changed, nothing sent
+    server->update();
+    BENCH_CHECK(server->getClientCount() == 1);
+    BENCH_CHECK(client->take().empty());
+
+    auto aId = registry->identify(a);
+    auto bId = registry->identify(b);
+    auto cId = registry->identify(c);
+    auto eId = registry->identify(e);
+    auto sceneId = registry->identify(scene);
+
+    auto d = new CCNode();
+    d->addChild(new CCNode());
+    a->addChild(d);
+    scene->removeChild(b);
+    delete b;
+    scene->reorderChild(e, -1);
+    c->setPosition(10.f, 20.f);
+    server->update();
+
+    // all of it in a single delta
+    messages = receive(client);
+    BENCH_CHECK(messages.size() == 1);
+    BENCH_CHECK(countType(messages, "delta") == 1);
+    auto add = findChange(messages, "add", aId);
+    BENCH_CHECK(add);
+    if (add) {
+        BENCH_CHECK((*add)["index"].asInt().unwrapOr(-1) == 1);
+        BENCH_CHECK((*add)["nodes"].size() == 2);
+        BENCH_CHECK((*add)["nodes"][0]["node"].asInt().unwrapOr(0) == static_cast<intmax_t>(registry->identify(d)));
+    }
+    BENCH_CHECK(findChange(messages, "remove", bId));
+    auto order = findChange(messages, "order", sceneId);
+    BENCH_CHECK(order);
+    if (order) {
+        auto& children = (*order)["children"];
+        BENCH_CHECK(children.size() == 2);
+        BENCH_CHECK(children[0].asInt().unwrapOr(0) == static_cast<intmax_t>(eId));
+        BENCH_CHECK(children[1].asInt().unwrapOr(0) == static_cast<intmax_t>(aId));
+    }
+    auto props = findChange(messages, "props", cId);
+    BENCH_CHECK(props);
+    if (props) {
+        BENCH_CHECK((*props)["attributes"]["position"][0].asDouble().unwrapOr(0) == 10.0);
+        BENCH_CHECK((*props)["attributes"]["position"][1].asDouble().unwrapOr(0) == 20.0);
+    }
+
+    // edits come back as a reply and go out to everyone in the frame's delta
+    client->push(fmt::format(R"({{"type":"set","node":{},"property":"position","value":[5,6]}})", cId));
+    client->push(fmt::format(R"({{"type":"set","node":{},"property":"opacity","value":128}})", cId));
+    client->push(fmt::format(R"({{"type":"set","node":{},"property":"id","value":"renamed"}})", eId));
+    client->push(fmt::format(R"({{"type":"set","node":{},"property":"position","value":[1,1]}})", bId));
+    server->update();
+    BENCH_CHECK(c->getPositionX() == 5.f && c->getPositionY() == 6.f);
+    BENCH_CHECK(c->getOpacity() == 128);
+    BENCH_CHECK(e->getID() == "renamed");
+
+    messages = receive(client);
+    BENCH_CHECK(countType(messages, "set") == 3);
+    // b is gone
+    BENCH_CHECK(countType(messages, "error") == 1);
+    BENCH_CHECK(countType(messages, "delta") == 1);
+    props = findChange(messages, "props", cId);
+    BENCH_CHECK(props);
+    if (props) {
+        BENCH_CHECK((*props)["attributes"]["position"][0].asDouble().unwrapOr(0) == 5.0);
+        BENCH_CHECK((*props)["attributes"]["opacity"].asInt().unwrapOr(0) == 128);
+    }
+    props = findChange(messages, "props", eId);
+    BENCH_CHECK(props && (*props)["attributes"]["id"].asString().unwrapOr("") == "renamed");
+
+    client->close();
+    server->update();
+    BENCH_CHECK(server->getClientCount() == 0);
+    delete scene;
+
+    if (g_benchFailures) {
+        std::fprintf(stderr, "%d checks failed\n", g_benchFailures);
+        return 1;
+    }
+    std::printf("inspection server: all checks passed\n");
+    return 0;
+}
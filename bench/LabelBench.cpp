@@ -0,0 +1,66 @@
+#include "Bench.hpp"
+#include "MockNode.hpp"
+#include "../src/LabelArena.hpp"
+#include "../src/NodeLabel.hpp"
+#include <string>
+
+namespace {
+    void collect(MockNode* node, std::vector<MockNode*>& nodes) {
+        nodes.push_back(node);
+        for (auto& child : node->children) {
+            collect(child.get(), nodes);
+        }
+    }
+}
+
+// Tree labels are formatted into a scratch buffer and copied into the arena
+void benchLabels(BenchOptions const& options) {
+    if (options.quick) {
+        std::string label;
+        formatNodeNameTo(label, { .className = "cocos2d::CCNode", .index = 3 });
+        BENCH_CHECK(label == "[3] cocos2d::CCNode ");
+        label.clear();
+        formatNodeNameTo(label, {
+            .className = "CCMenuItemSpriteExtra", .id = "play-button", .tag = 5,
+            .childCount = 2, .index = 0, .fake = true, .flagHidden = true
+        });
+        BENCH_CHECK(label == "[*...0] CCMenuItemSpriteExtra (5) \"play-button\" <2> ");
+    }
+
+    for (auto size : options.sizes) {
+        auto tree = makeSyntheticTree(size);
+        std::vector<MockNode*> nodes;
+        nodes.reserve(size);
+        collect(tree.get(), nodes);
+
+        LabelArena arena;
+        std::vector<std::string_view> labels(nodes.size());
+        std::string buffer;
+        size_t expectedUsed = 0;
+        measure(options, "labels/format+store " + std::to_string(size), size, [&] {
+            arena.reset();
+            expectedUsed = 0;
+            for (size_t i = 0; i < nodes.size(); i++) {
+                auto node = nodes[i];
+                buffer.clear();
+                formatNodeNameTo(buffer, {
+                    .className = node->className,
+                    .id = node->id,
+                    .tag = node->tag,
+                    .childCount = node->children.size(),
+                    .index = i,
+                });
+                labels[i] = arena.store(buffer);
+                expectedUsed += buffer.size() + 1;
+            }
+        });
+
+        if (options.quick) {
+            BENCH_CHECK(arena.used() == expectedUsed);
+            for (size_t i = 0; i < nodes.size(); i++) {
+                BENCH_CHECK(labels[i].data()[labels[i].size()] == '\0');
+                BENCH_CHECK(labels[i].find(nodes[i]->className) != std::string_view::npos);
+            }
+        }
+    }
+}
@@ -0,0 +1,88 @@
+#include "Bench.hpp"
+#include "../src/platform/MemoryScan.hpp"
+#include <memory>
+#include <string>
+#include <vector>
+
+// not in an anonymous namespace, those get a '*' in front of their typeinfo name
+struct BenchObject {
+    virtual ~BenchObject() = default;
+    int value = 0;
+};
+
+namespace {
+    struct ScanRecord {
+        BenchObject* object;
+        std::string shortString;
+        std::string longString;
+        uintptr_t raw;
+    };
+
+    struct ScanCounts {
+        size_t objects = 0;
+        size_t strings = 0;
+        size_t raw = 0;
+    };
+
+    // the same classification the Memory page does for every pointer sized slot
+    ScanCounts scan(void const* data, size_t size) {
+        ScanCounts counts;
+        auto addr = reinterpret_cast<uintptr_t>(data);
+        for (size_t offset = 0; offset < size; offset += sizeof(void*)) {
+            SafePtr ptr = addr + offset;
+            RttiInfo info(ptr.read_ptr());
+            if (auto name = info.class_name(); name && !name->empty()) {
+                counts.objects += 1;
+            }
+            else if (findStdString(ptr)) {
+                counts.strings += 1;
+            }
+            else if (ptr.read_opt<uintptr_t>()) {
+                counts.raw += 1;
+            }
+        }
+        return counts;
+    }
+}
+
+void benchMemoryScan(BenchOptions const& options) {
+    // readable memory is looked up once and cached, so everything gets allocated up front
+    std::vector<std::unique_ptr<BenchObject>> objects;
+    std::vector<std::vector<ScanRecord>> regions;
+    for (auto size : options.sizes) {
+        auto& records = regions.emplace_back(size / sizeof(ScanRecord) + 1);
+        for (size_t i = 0; i < records.size(); i++) {
+            objects.push_back(std::make_unique<BenchObject>());
+            records[i] = {
+                .object = objects.back().get(),
+                .shortString = "short " + std::to_string(i % 100),
+                .longString = "a string that is too long for the inline buffer " + std::to_string(i),
+                .raw = 0x12345678,
+            };
+        }
+    }
+
+    BENCH_CHECK(!canReadAddr(0, sizeof(void*)));
+    BENCH_CHECK(SafePtr(regions.front().data()).is_safe(sizeof(ScanRecord)));
+
+    for (size_t i = 0; i < options.sizes.size(); i++) {
+        auto& records = regions[i];
+        auto bytes = records.size() * sizeof(ScanRecord);
+        ScanCounts counts;
+        measure(options, "memory/scan " + std::to_string(bytes) + " bytes", bytes / sizeof(void*), [&] {
+            counts = scan(records.data(), bytes);
+        });
+        if (options.quick) {
+            BENCH_CHECK(counts.objects == records.size());
+            BENCH_CHECK(counts.strings == records.size() * 2);
+        }
+    }
+
+    char const* mangled[] = { "11BenchObject", "N7cocos2d6CCNodeE", "N7cocos2d9extension14CCScale9SpriteE" };
+    measure(options, "memory/demangle (cached)", std::size(mangled), [&] {
+        for (auto name : mangled) {
+            BENCH_CHECK(!demangle(name).empty());
+        }
+    });
+    BENCH_CHECK(demangle("N7cocos2d6CCNodeE") == "cocos2d::CCNode");
+}
@@ -0,0 +1,297 @@
+// What the inspection server test needs from the game and from Geode: the node tree in
+// stubs/cocos2d.h, and stand-ins for the registry, journal and setter hooks, whose real
+// versions are made of Geode hooks. They do what the hooks would.
+
+#include "../src/NodeRegistry.hpp"
+#include "../src/SceneJournal.hpp"
+#include "../src/SetterHooks.hpp"
+#include "../src/InspectionServer.hpp"
+#include "../src/platform/utils.hpp"
+#include <Geode/ui/OverlayManager.hpp>
+#include <Geode/utils/cocos.hpp>
+#include <Geode/utils/file.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <fstream>
+#include <typeindex>
+
+using namespace geode::prelude;
+
+namespace {
+    // stands in for the identity field the real registry keeps on each node
+    std::unordered_map<CCNode*, uint64_t> s_identities;
+
+    void setterCalled(CCNode* node) {
+        SetterHooks::get()->setterCalled(node);
+    }
+
+    void recordChange(SceneChangeType type, CCNode* node, CCNode* parent) {
+        auto journal = SceneJournal::get();
+        if (journal->isRecording()) {
+            journal->record(type, node, parent);
+        }
+    }
+}
+
+NodeRegistry* NodeRegistry::get() {
+    static auto inst = new NodeRegistry();
+    return inst;
+}
+
+uint64_t NodeRegistry::identify(CCNode* node) {
+    if (!node) return 0;
+    auto& identity = s_identities[node];
+    if (!identity) {
+        identity = m_nextIdentity++;
+        m_nodes[identity] = node;
+    }
+    return identity;
+}
+
+CCNode* NodeRegistry::find(uint64_t identity) const {
+    auto it = m_nodes.find(identity);
+    return it != m_nodes.end() ? it->second : nullptr;
+}
+
+size_t NodeRegistry::size() const {
+    return m_nodes.size();
+}
+
+void NodeRegistry::release(uint64_t identity) {
+    m_nodes.erase(identity);
+    m_released.push_back(identity);
+}
+
+bool NodeRegistry::takeReleased(std::vector<uint64_t>& released) {
+    released.swap(m_released);
+    m_released.clear();
+    return !std::exchange(m_releasedOverflow, false);
+}
+
+SceneJournal* SceneJournal::get() {
+    static auto inst = new SceneJournal();
+    return inst;
+}
+
+void SceneJournal::record(SceneChangeType type, CCNode* node, CCNode* parent) {
+    m_entries[m_generation % CAPACITY] = { type, node, parent };
+    m_generation += 1;
+}
+
+uint64_t SceneJournal::generation() const {
+    return m_generation;
+}
+
+void SceneJournal::reset() {
+    m_validFrom = m_generation;
+}
+
+bool SceneJournal::isRecording() const {
+    return m_readers != 0;
+}
+
+void SceneJournal::setRecording(SceneJournalReader reader, bool recording) {
+    if (recording && !m_readers) {
+        this->reset();
+    }
+    if (recording) {
+        m_readers |= static_cast<uint8_t>(reader);
+    }
+    else {
+        m_readers &= ~static_cast<uint8_t>(reader);
+    }
+}
+
+SetterHooks* SetterHooks::get() {
+    static auto inst = new SetterHooks();
+    return inst;
+}
+
+void SetterHooks::setEnabled(SetterHookUser user, bool enabled) {
+    if (enabled) {
+        m_users |= static_cast<uint8_t>(user);
+    }
+    else {
+        m_users &= ~static_cast<uint8_t>(user);
+    }
+}
+
+bool SetterHooks::isEnabled(SetterHookUser user) const {
+    return m_users & static_cast<uint8_t>(user);
+}
+
+void SetterHooks::beginCount() {
+    m_counting = true;
+    m_count = 0;
+}
+
+size_t SetterHooks::endCount() {
+    m_counting = false;
+    return m_count;
+}
+
+void SetterHooks::setterCalled(CCNode* node) {
+    // the real hooks are off while nobody uses them
+    if (!m_users) return;
+    if (m_counting) {
+        m_count += 1;
+    }
+    if (m_users & static_cast<uint8_t>(SetterHookUser::Server)) {
+        InspectionServer::get()->propertiesChanged(node);
+    }
+}
+
+namespace cocos2d {
+    CCNode::~CCNode() {
+        if (m_pChildren) {
+            for (auto child : m_pChildren->data) {
+                delete child;
+            }
+            delete m_pChildren;
+        }
+        auto it = s_identities.find(this);
+        if (it != s_identities.end()) {
+            NodeRegistry::get()->release(it->second);
+            s_identities.erase(it);
+        }
+    }
+
+    void CCNode::addChild(CCNode* child) {
+        if (!m_pChildren) m_pChildren = new CCArray();
+        // stable by z order, like sortAllChildren
+        auto it = std::upper_bound(
+            m_pChildren->data.begin(), m_pChildren->data.end(), child->m_nZOrder,
+            [](int zOrder, CCObject* other) { return zOrder < static_cast<CCNode*>(other)->m_nZOrder; }
+        );
+        m_pChildren->data.insert(it, child);
+        child->m_pParent = this;
+        recordChange(SceneChangeType::AddChild, child, this);
+    }
+
+    void CCNode::removeChild(CCNode* child) {
+        recordChange(SceneChangeType::RemoveChild, child, this);
+        std::erase(m_pChildren->data, child);
+        child->m_pParent = nullptr;
+    }
+
+    void CCNode::reorderChild(CCNode* child, int zOrder) {
+        child->m_nZOrder = zOrder;
+        std::stable_sort(m_pChildren->data.begin(), m_pChildren->data.end(), [](CCObject* a, CCObject* b) {
+            return static_cast<CCNode*>(a)->m_nZOrder < static_cast<CCNode*>(b)->m_nZOrder;
+        });
+        recordChange(SceneChangeType::Reorder, child, this);
+    }
+
+    void CCNode::setID(std::string const& id) {
+        m_id = id;
+        recordChange(SceneChangeType::SetID, this, m_pParent);
+    }
+
+    void CCNode::setPosition(float x, float y) {
+        m_obPosition = { x, y };
+        setterCalled(this);
+    }
+
+    void CCNode::setScaleX(float scale) {
+        m_fScaleX = scale;
+        setterCalled(this);
+    }
+
+    void CCNode::setScaleY(float scale) {
+        m_fScaleY = scale;
+        setterCalled(this);
+    }
+
+    void CCNode::setRotation(float rotation) {
+        m_fRotationX = m_fRotationY = rotation;
+        setterCalled(this);
+    }
+
+    void CCNode::setSkewX(float skew) {
+        m_fSkewX = skew;
+        setterCalled(this);
+    }
+
+    void CCNode::setSkewY(float skew) {
+        m_fSkewY = skew;
+        setterCalled(this);
+    }
+
+    void CCNode::setAnchorPoint(CCPoint const& point) {
+        m_obAnchorPoint = point;
+        setterCalled(this);
+    }
+
+    void CCNode::setContentSize(CCSize const& size) {
+        m_obContentSize = size;
+        setterCalled(this);
+    }
+
+    void CCNode::setVisible(bool visible) {
+        m_bVisible = visible;
+        setterCalled(this);
+    }
+
+    void CCNode::setZOrder(int zOrder) {
+        if (m_pParent) {
+            m_pParent->reorderChild(this, zOrder);
+        }
+        else {
+            m_nZOrder = zOrder;
+        }
+        setterCalled(this);
+    }
+
+    void CCNode::setTag(int tag) {
+        m_nTag = tag;
+        setterCalled(this);
+    }
+
+    void CCNodeRGBA::setOpacity(GLubyte opacity) {
+        m_nOpacity = opacity;
+        setterCalled(this);
+    }
+
+    CCDirector* CCDirector::get() {
+        static auto inst = new CCDirector();
+        return inst;
+    }
+}
+
+namespace geode {
+    OverlayManager* OverlayManager::get() {
+        static auto inst = new OverlayManager();
+        return inst;
+    }
+
+    Mod* Mod::get() {
+        static auto inst = new Mod();
+        return inst;
+    }
+
+    std::filesystem::path Mod::getSaveDir() const {
+        auto dir = std::filesystem::temp_directory_path() / "devtools-bench";
+        std::error_code ec;
+        std::filesystem::create_directories(dir, ec);
+        return dir;
+    }
+
+    Result<void> utils::file::writeString(std::filesystem::path const& path, std::string const& data) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file << data;
+        return Result<void>(static_cast<bool>(file), file ? "" : "Unable to write " + path.string());
+    }
+}
+
+std::string_view getObjectClassName(CCObject* obj) {
+    static std::unordered_map<std::type_index, std::string> names;
+    auto [it, inserted] = names.try_emplace(typeid(*obj));
+    if (inserted) {
+        int status = 0;
+        auto demangled = abi::__cxa_demangle(it->first.name(), nullptr, nullptr, &status);
+        it->second = status == 0 ? demangled : it->first.name();
+        std::free(demangled);
+    }
+    return it->second;
+}
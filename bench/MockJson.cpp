@@ -0,0 +1,171 @@
+#include <matjson.hpp>
+#include <cmath>
+#include <cstdlib>
+
+using geode::Err;
+using geode::Ok;
+
+namespace matjson {
+    namespace {
+        Value const s_null;
+
+        class Parser {
+        public:
+            std::string_view source;
+            size_t pos = 0;
+            bool failed = false;
+
+            void skipSpace() {
+                while (pos < source.size() && (source[pos] == ' ' || source[pos] == '\t' || source[pos] == '\n' || source[pos] == '\r')) pos++;
+            }
+
+            bool consume(char c) {
+                this->skipSpace();
+                if (pos < source.size() && source[pos] == c) {
+                    pos++;
+                    return true;
+                }
+                return false;
+            }
+
+            bool consumeWord(std::string_view word) {
+                if (source.substr(pos).starts_with(word)) {
+                    pos += word.size();
+                    return true;
+                }
+                failed = true;
+                return false;
+            }
+
+            std::string parseString() {
+                std::string out;
+                if (!this->consume('"')) {
+                    failed = true;
+                    return out;
+                }
+                while (pos < source.size() && source[pos] != '"') {
+                    char c = source[pos++];
+                    if (c != '\\') {
+                        out += c;
+                        continue;
+                    }
+                    if (pos >= source.size()) break;
+                    switch (char e = source[pos++]) {
+                        case 'n': out += '\n'; break;
+                        case 't': out += '\t'; break;
+                        case 'r': out += '\r'; break;
+                        case 'b': out += '\b'; break;
+                        case 'f': out += '\f'; break;
+                        case 'u': {
+                            // only what appendJsonString escapes, control characters
+                            out += static_cast<char>(std::strtol(std::string(source.substr(pos, 4)).c_str(), nullptr, 16));
+                            pos += 4;
+                        } break;
+                        default: out += e; break;
+                    }
+                }
+                if (!this->consume('"')) failed = true;
+                return out;
+            }
+
+            Value parseValue(int depth) {
+                Value value;
+                this->skipSpace();
+                if (depth > 256 || pos >= source.size()) {
+                    failed = true;
+                    return value;
+                }
+                char c = source[pos];
+                if (c == '{') {
+                    pos++;
+                    value.type = Type::Object;
+                    if (this->consume('}')) return value;
+                    do {
+                        auto key = this->parseString();
+                        if (!this->consume(':')) failed = true;
+                        if (failed) return value;
+                        value.object[key] = this->parseValue(depth + 1);
+                    } while (!failed && this->consume(','));
+                    if (!this->consume('}')) failed = true;
+                }
+                else if (c == '[') {
+                    pos++;
+                    value.type = Type::Array;
+                    if (this->consume(']')) return value;
+                    do {
+                        value.array.push_back(this->parseValue(depth + 1));
+                    } while (!failed && this->consume(','));
+                    if (!this->consume(']')) failed = true;
+                }
+                else if (c == '"') {
+                    value.type = Type::String;
+                    value.string = this->parseString();
+                }
+                else if (c == 't' || c == 'f') {
+                    value.type = Type::Bool;
+                    value.boolean = c == 't';
+                    this->consumeWord(value.boolean ? "true" : "false");
+                }
+                else if (c == 'n') {
+                    this->consumeWord("null");
+                }
+                else {
+                    std::string number(source.substr(pos, 64));
+                    char* end = nullptr;
+                    value.type = Type::Number;
+                    value.number = std::strtod(number.c_str(), &end);
+                    if (end == number.c_str()) failed = true;
+                    pos += static_cast<size_t>(end - number.c_str());
+                }
+                return value;
+            }
+        };
+    }
+
+    Value const& Value::operator[](std::string_view key) const {
+        auto it = object.find(key);
+        return it == object.end() ? s_null : it->second;
+    }
+
+    Value const& Value::operator[](size_t index) const {
+        return index < array.size() ? array[index] : s_null;
+    }
+
+    bool Value::contains(std::string_view key) const {
+        return object.find(key) != object.end();
+    }
+
+    size_t Value::size() const {
+        return type == Type::Object ? object.size() : array.size();
+    }
+
+    geode::Result<std::string> Value::asString() const {
+        if (type != Type::String) return Err<std::string, std::string>("not a string");
+        return Ok(string);
+    }
+
+    geode::Result<intmax_t> Value::asInt() const {
+        if (type != Type::Number) return Err<intmax_t, std::string>("not a number");
+        return Ok(static_cast<intmax_t>(number));
+    }
+
+    geode::Result<double> Value::asDouble() const {
+        if (type != Type::Number) return Err<double, std::string>("not a number");
+        return Ok(number);
+    }
+
+    geode::Result<bool> Value::asBool() const {
+        if (type != Type::Bool) return Err<bool, std::string>("not a bool");
+        return Ok(boolean);
+    }
+
+    geode::Result<Value> parse(std::string_view source) {
+        Parser parser { .source = source };
+        auto value = parser.parseValue(0);
+        parser.skipSpace();
+        if (parser.failed || parser.pos != source.size()) {
+            return Err<Value, std::string>("invalid json");
+        }
+        return Ok(std::move(value));
+    }
+}
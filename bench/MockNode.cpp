@@ -0,0 +1,113 @@
+#include "MockNode.hpp"
+#include "../src/SearchWorker.hpp"
+#include <deque>
+#include <random>
+#include <span>
+
+namespace {
+    enum class Kind {
+        Scene,
+        MenuLayer,
+        Layer,
+        Node,
+        Menu,
+        MenuItem,
+        ButtonSprite,
+        Sprite,
+        Label,
+        Scale9,
+    };
+
+    constexpr std::string_view CLASS_NAMES[] = {
+        "cocos2d::ccscene",
+        "menulayer",
+        "cocos2d::cclayer",
+        "cocos2d::ccnode",
+        "cocos2d::ccmenu",
+        "ccmenuitemspriteextra",
+        "buttonsprite",
+        "cocos2d::ccsprite",
+        "cocos2d::cclabelbmfont",
+        "cocos2d::extension::ccscale9sprite",
+    };
+
+    struct Shape {
+        int minChildren;
+        int maxChildren;
+        std::span<Kind const> children;
+    };
+
+    constexpr Kind SCENE_CHILDREN[] = { Kind::MenuLayer };
+    constexpr Kind LAYER_CHILDREN[] = { Kind::Menu, Kind::Layer, Kind::Node, Kind::Sprite, Kind::Label, Kind::Scale9 };
+    constexpr Kind MENU_CHILDREN[] = { Kind::MenuItem };
+    constexpr Kind MENU_ITEM_CHILDREN[] = { Kind::ButtonSprite, Kind::Sprite };
+    constexpr Kind BUTTON_SPRITE_CHILDREN[] = { Kind::Label, Kind::Scale9 };
+
+    Shape shapeOf(Kind kind) {
+        switch (kind) {
+            case Kind::Scene: return { 1, 2, SCENE_CHILDREN };
+            case Kind::MenuLayer:
+            case Kind::Layer:
+            case Kind::Node: return { 2, 8, LAYER_CHILDREN };
+            case Kind::Menu: return { 2, 12, MENU_CHILDREN };
+            case Kind::MenuItem: return { 1, 1, MENU_ITEM_CHILDREN };
+            case Kind::ButtonSprite: return { 2, 2, BUTTON_SPRITE_CHILDREN };
+            default: return { 0, 0, {} };
+        }
+    }
+
+    struct Pending {
+        MockNode* node;
+        Kind kind;
+    };
+}
+
+std::unique_ptr<MockNode> makeSyntheticTree(size_t count) {
+    std::mt19937 rng(static_cast<uint32_t>(count));
+    auto root = std::make_unique<MockNode>();
+    root->className = CLASS_NAMES[static_cast<size_t>(Kind::Scene)];
+    size_t made = 1;
+
+    std::deque<Pending> open = { { root.get(), Kind::Scene } };
+    while (made < count) {
+        if (open.empty()) {
+            // ran out of containers, keep growing the scene
+            open.push_back({ root.get(), Kind::Scene });
+        }
+        auto [parent, kind] = open.front();
+        open.pop_front();
+
+        auto shape = shapeOf(kind);
+        if (shape.children.empty()) continue;
+        auto children = std::uniform_int_distribution(shape.minChildren, shape.maxChildren)(rng);
+        for (int i = 0; i < children && made < count; i++) {
+            auto childKind = shape.children[rng() % shape.children.size()];
+            auto child = std::make_unique<MockNode>();
+            child->className = CLASS_NAMES[static_cast<size_t>(childKind)];
+            child->tag = static_cast<int>(made % 10);
+            child->visible = made % 7 != 0;
+            if (childKind == Kind::MenuItem) {
+                child->id = "item-" + std::to_string(made) + "-button";
+            }
+            else if (made % 4 == 0) {
+                child->id = "node-" + std::to_string(made);
+            }
+            open.push_back({ child.get(), childKind });
+            parent->children.push_back(std::move(child));
+            made += 1;
+        }
+    }
+    return root;
+}
+
+void snapshotMockTree(MockNode* node, size_t parent, SceneSnapshot& snapshot, uint64_t& nextIdentity) {
+    auto index = snapshot.nodes.size();
+    snapshot.add(
+        reinterpret_cast<cocos2d::CCNode*>(node), nextIdentity++, parent,
+        node->className, node->id, node->tag,
+        node->visible, node->children.size()
+    );
+    for (auto& child : node->children) {
+        snapshotMockTree(child.get(), index, snapshot, nextIdentity);
+    }
+}
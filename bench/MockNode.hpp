@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct SceneSnapshot;
+
+// Stand-in for a CCNode with just what DevTools reads off nodes for the Tree
+struct MockNode {
+    // lowercase and namespaced like getObjectClassNameLower, points into a static table
+    std::string_view className;
+    std::string id;
+    int tag = -1;
+    bool visible = true;
+    std::vector<std::unique_ptr<MockNode>> children;
+};
+
+// A GD-like tree (scene, layers, menus, buttons, sprites, labels) of exactly `count` nodes.
+// Always the same tree for the same count.
+std::unique_ptr<MockNode> makeSyntheticTree(size_t count);
+
+// Same walk as DevTools::snapshotSearchBranch
+void snapshotMockTree(MockNode* node, size_t parent, SceneSnapshot& snapshot, uint64_t& nextIdentity);
@@ -0,0 +1,245 @@
+#include "RecordingGL.hpp"
+#include <cocos2d.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace cocos2d;
+
+namespace {
+    struct Buffer {
+        size_t size = 0;
+        // ranges uploaded since the storage was last (re)specified
+        std::vector<std::pair<size_t, size_t>> written;
+        // whether a draw call read from the current storage
+        bool drawnFrom = false;
+    };
+
+    struct VertexArray {
+        GLuint elementBuffer = 0;
+    };
+
+    struct State {
+        std::string extensions = "GL_ARB_vertex_array_object";
+        GLuint nextName = 1;
+        std::unordered_map<GLuint, Buffer> buffers;
+        std::unordered_map<GLuint, VertexArray> vertexArrays;
+        GLuint boundVertexArray = 0;
+        GLuint boundArrayBuffer = 0;
+        // element buffer binding of vertex array 0
+        GLuint defaultElementBuffer = 0;
+        // array buffer the vertex attributes were last pointed into
+        GLuint attribBuffer = 0;
+        GLFrameStats frame;
+    };
+
+    State& state() {
+        static State inst;
+        return inst;
+    }
+
+    // `what` is only there to say what went wrong at the call site
+    void error([[maybe_unused]] char const* what) {
+        state().frame.errors += 1;
+    }
+
+    GLuint* elementBinding() {
+        auto& s = state();
+        if (s.boundVertexArray == 0) return &s.defaultElementBuffer;
+        auto it = s.vertexArrays.find(s.boundVertexArray);
+        return it != s.vertexArrays.end() ? &it->second.elementBuffer : nullptr;
+    }
+
+    Buffer* boundBuffer(GLenum target) {
+        auto& s = state();
+        GLuint name = 0;
+        if (target == GL_ARRAY_BUFFER) {
+            name = s.boundArrayBuffer;
+        }
+        else if (auto binding = elementBinding()) {
+            name = *binding;
+        }
+        auto it = s.buffers.find(name);
+        return it != s.buffers.end() ? &it->second : nullptr;
+    }
+}
+
+void recording_gl::beginFrame() {
+    state().frame = {};
+}
+
+GLFrameStats const& recording_gl::frame() {
+    return state().frame;
+}
+
+void recording_gl::setExtensions(std::string extensions) {
+    state().extensions = std::move(extensions);
+}
+
+void recording_gl::loseContext() {
+    auto& s = state();
+    s.buffers.clear();
+    s.vertexArrays.clear();
+    s.boundVertexArray = 0;
+    s.boundArrayBuffer = 0;
+    s.defaultElementBuffer = 0;
+    s.attribBuffer = 0;
+}
+
+size_t recording_gl::liveObjects() {
+    return state().buffers.size() + state().vertexArrays.size();
+}
+
+GLubyte const* glGetString(GLenum name) {
+    if (name != GL_EXTENSIONS) return nullptr;
+    return reinterpret_cast<GLubyte const*>(state().extensions.c_str());
+}
+
+void glEnable(GLenum) {
+    state().frame.capabilityChanges += 1;
+}
+
+void glDisable(GLenum) {
+    state().frame.capabilityChanges += 1;
+}
+
+void glGenVertexArrays(GLsizei n, GLuint* arrays) {
+    for (GLsizei i = 0; i < n; i++) {
+        arrays[i] = state().nextName++;
+        state().vertexArrays[arrays[i]] = {};
+    }
+}
+
+void glBindVertexArray(GLuint array) {
+    if (array != 0 && !state().vertexArrays.contains(array)) {
+        return error("bound a vertex array that doesn't exist");
+    }
+    state().boundVertexArray = array;
+}
+
+void glDeleteVertexArrays(GLsizei n, GLuint const* arrays) {
+    for (GLsizei i = 0; i < n; i++) {
+        state().vertexArrays.erase(arrays[i]);
+        if (state().boundVertexArray == arrays[i]) state().boundVertexArray = 0;
+    }
+}
+
+void glGenBuffers(GLsizei n, GLuint* buffers) {
+    for (GLsizei i = 0; i < n; i++) {
+        buffers[i] = state().nextName++;
+        state().buffers[buffers[i]] = {};
+    }
+}
+
+void glBindBuffer(GLenum target, GLuint buffer) {
+    auto& s = state();
+    if (buffer != 0 && !s.buffers.contains(buffer)) {
+        return error("bound a buffer that doesn't exist");
+    }
+    if (target == GL_ARRAY_BUFFER) {
+        s.boundArrayBuffer = buffer;
+    }
+    else if (auto binding = elementBinding()) {
+        *binding = buffer;
+    }
+}
+
+void glDeleteBuffers(GLsizei n, GLuint const* buffers) {
+    for (GLsizei i = 0; i < n; i++) {
+        state().buffers.erase(buffers[i]);
+    }
+}
+
+void glBufferData(GLenum target, GLsizeiptr size, void const*, GLenum) {
+    auto buffer = boundBuffer(target);
+    if (!buffer) return error("glBufferData without a buffer bound");
+    auto& frame = state().frame;
+    frame.bufferDataCalls += 1;
+    if (static_cast<size_t>(size) > buffer->size) {
+        frame.bufferAllocations += 1;
+    }
+    buffer->size = static_cast<size_t>(size);
+    buffer->written.clear();
+    buffer->drawnFrom = false;
+}
+
+void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void const*) {
+    auto buffer = boundBuffer(target);
+    if (!buffer) return error("glBufferSubData without a buffer bound");
+    auto start = static_cast<size_t>(offset);
+    auto end = start + static_cast<size_t>(size);
+    if (end > buffer->size) return error("glBufferSubData past the end of the buffer");
+
+    auto& frame = state().frame;
+    frame.bytesUploaded += static_cast<size_t>(size);
+    if (buffer->drawnFrom) {
+        for (auto [writtenStart, writtenEnd] : buffer->written) {
+            if (start < writtenEnd && writtenStart < end) {
+                frame.syncStalls += 1;
+                break;
+            }
+        }
+    }
+    buffer->written.push_back({ start, end });
+}
+
+void glEnableVertexAttribArray(GLuint) {}
+
+void glVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, void const*) {
+    state().attribBuffer = state().boundArrayBuffer;
+}
+
+void glDrawElements(GLenum, GLsizei count, GLenum type, void const* indices) {
+    auto& s = state();
+    s.frame.drawCalls += 1;
+    auto elements = boundBuffer(GL_ELEMENT_ARRAY_BUFFER);
+    auto vertices = s.buffers.find(s.attribBuffer);
+    if (!elements || vertices == s.buffers.end()) {
+        return error("glDrawElements without buffers");
+    }
+    auto offset = reinterpret_cast<size_t>(indices);
+    auto size = static_cast<size_t>(count) * (type == GL_UNSIGNED_SHORT ? 2 : 4);
+    if (offset + size > elements->size) {
+        return error("glDrawElements past the end of the element buffer");
+    }
+    elements->drawnFrom = true;
+    vertices->second.drawnFrom = true;
+}
+
+void glDrawArrays(GLenum, GLint, GLsizei) {
+    state().frame.drawCalls += 1;
+}
+
+CCShaderCache* CCShaderCache::sharedShaderCache() {
+    static CCShaderCache inst;
+    return &inst;
+}
+
+CCGLProgram* CCShaderCache::programForKey(char const*) {
+    static CCGLProgram program;
+    return &program;
+}
+
+void CCEGLView::setScissorInPoints(float, float, float, float) {
+    state().frame.scissorChanges += 1;
+}
+
+CCDirector* CCDirector::sharedDirector() {
+    static CCDirector inst;
+    return &inst;
+}
+
+CCEGLView* CCDirector::getOpenGLView() {
+    static CCEGLView view;
+    return &view;
+}
+
+CCSize CCDirector::getWinSize() {
+    return CCSize(569.f, 320.f);
+}
+
+void cocos2d::ccGLBindTexture2D(GLuint) {
+    state().frame.textureBinds += 1;
+}
+
+void cocos2d::ccGLEnableVertexAttribs(unsigned int) {}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+// What the recording GL saw since the last beginFrame
+struct GLFrameStats {
+    size_t drawCalls = 0;
+    size_t textureBinds = 0;
+    size_t scissorChanges = 0;
+    size_t capabilityChanges = 0;
+    // glBufferData calls that had to grow a buffer's storage
+    size_t bufferAllocations = 0;
+    size_t bufferDataCalls = 0;
+    size_t bytesUploaded = 0;
+    // glBufferSubData over data a draw call already used without new storage in between,
+    // which a real driver would have to wait on the GPU for
+    size_t syncStalls = 0;
+    // unknown or deleted names, out of bounds uploads and draws
+    size_t errors = 0;
+};
+
+namespace recording_gl {
+    void beginFrame();
+    GLFrameStats const& frame();
+
+    // GL_EXTENSIONS, VAOs are only used when it has GL_ARB_vertex_array_object
+    void setExtensions(std::string extensions);
+    // Forgets every object like a new context would, names handed out before are invalid now
+    void loseContext();
+    size_t liveObjects();
+}
@@ -0,0 +1,187 @@
+#include "Bench.hpp"
+#include "RecordingGL.hpp"
+#include "../src/ImGuiRenderer.hpp"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace {
+    constexpr ImTextureID FONT_ATLAS = 1;
+    constexpr int COMMANDS_PER_WINDOW = 40;
+    constexpr int QUADS_PER_COMMAND = 25;
+
+    struct Fixture {
+        std::vector<std::unique_ptr<ImDrawList>> lists;
+        ImDrawData data;
+        // what a good backend would do with it
+        size_t visibleCommands = 0;
+        size_t visibleTriangles = 0;
+        size_t textureChanges = 0;
+        size_t bytes = 0;
+    };
+
+    // `quads` spread over windows of text and the odd image, with some commands
+    // clipped away entirely like ImGui emits for collapsed or scrolled out parts
+    std::unique_ptr<Fixture> makeFixture(size_t quads) {
+        auto fixture = std::make_unique<Fixture>();
+        fixture->data.DisplaySize = ImVec2(1920.f, 1080.f);
+
+        auto windows = std::max<size_t>(1, quads / (COMMANDS_PER_WINDOW * QUADS_PER_COMMAND));
+        auto lastTexture = ImTextureID_Invalid;
+        for (size_t w = 0; w < windows; w++) {
+            auto list = std::make_unique<ImDrawList>();
+            auto x = static_cast<float>(w % 8) * 200.f;
+            auto y = static_cast<float>(w / 8 % 8) * 120.f;
+            for (int c = 0; c < COMMANDS_PER_WINDOW; c++) {
+                ImDrawCmd cmd;
+                cmd.TexID = c % 10 == 9 ? static_cast<ImTextureID>(2 + c % 3) : FONT_ATLAS;
+                cmd.IdxOffset = static_cast<unsigned int>(list->IdxBuffer.Size);
+                cmd.ElemCount = QUADS_PER_COMMAND * 6;
+                auto clipped = c % 17 == 16;
+                cmd.ClipRect = clipped ?
+                    ImVec4(x, y, x, y + 100.f) :
+                    ImVec4(x, y, x + 190.f, y + 110.f);
+
+                for (int q = 0; q < QUADS_PER_COMMAND; q++) {
+                    auto base = static_cast<ImDrawIdx>(list->VtxBuffer.Size);
+                    auto qx = x + static_cast<float>(q) * 7.f;
+                    auto qy = y + static_cast<float>(c) * 2.f;
+                    for (auto [dx, dy] : { std::pair(0.f, 0.f), std::pair(6.f, 0.f), std::pair(6.f, 12.f), std::pair(0.f, 12.f) }) {
+                        list->VtxBuffer.push_back({ ImVec2(qx + dx, qy + dy), ImVec2(dx / 6.f, dy / 12.f), 0xffffffff });
+                    }
+                    for (auto i : { 0, 1, 2, 0, 2, 3 }) {
+                        list->IdxBuffer.push_back(static_cast<ImDrawIdx>(base + i));
+                    }
+                }
+                list->CmdBuffer.push_back(cmd);
+
+                if (!clipped) {
+                    fixture->visibleCommands += 1;
+                    fixture->visibleTriangles += cmd.ElemCount / 3;
+                    if (cmd.TexID != lastTexture) {
+                        fixture->textureChanges += 1;
+                        lastTexture = cmd.TexID;
+                    }
+                }
+            }
+            fixture->bytes += list->VtxBuffer.Size * sizeof(ImDrawVert) + list->IdxBuffer.Size * sizeof(ImDrawIdx);
+            fixture->data.CmdLists.push_back(list.get());
+            fixture->lists.push_back(std::move(list));
+        }
+        fixture->data.CmdListsCount = fixture->data.CmdLists.Size;
+        return fixture;
+    }
+
+    // the renderer converts vertices to cocos space in place, like ImGui a new frame
+    // starts from untouched draw data
+    void resetVertices(Fixture& fixture, std::vector<ImVector<ImDrawVert>> const& pristine) {
+        for (size_t i = 0; i < fixture.lists.size(); i++) {
+            fixture.lists[i]->VtxBuffer = pristine[i];
+        }
+    }
+
+    GLFrameStats renderFrame(ImGuiRenderer& renderer, Fixture& fixture, std::vector<ImVector<ImDrawVert>> const& pristine) {
+        resetVertices(fixture, pristine);
+        recording_gl::beginFrame();
+        renderer.renderDrawData(&fixture.data);
+        return recording_gl::frame();
+    }
+
+    // Make sure the harness itself notices uploads over data that is still being drawn
+    void checkStallDetection() {
+        recording_gl::loseContext();
+        GLuint vao, buffers[2];
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glGenBuffers(2, buffers);
+        glBindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+        glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glBufferData(GL_ARRAY_BUFFER, 64, nullptr, GL_STREAM_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, 64, nullptr, GL_STREAM_DRAW);
+
+        recording_gl::beginFrame();
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, 12, nullptr);
+        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, nullptr);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, 12, nullptr);
+        BENCH_CHECK(recording_gl::frame().syncStalls == 1);
+        BENCH_CHECK(recording_gl::frame().errors == 0);
+
+        glDeleteBuffers(2, buffers);
+        glDeleteVertexArrays(1, &vao);
+        recording_gl::loseContext();
+    }
+}
+
+// ImGuiRenderer against a recording GL: besides timing a frame, checks the budgets
+// a frame has to stay in once the UI stops growing (no allocations, no uploads the
+// driver would have to wait on, one draw per visible command) and that the GL objects
+// survive the context being rebuilt
+void benchRender(BenchOptions const& options) {
+    checkStallDetection();
+
+    for (auto size : options.sizes) {
+        // an ImGui frame is never anywhere near a million quads
+        if (size > 100'000) continue;
+
+        auto fixture = makeFixture(size);
+        std::vector<ImVector<ImDrawVert>> pristine;
+        for (auto& list : fixture->lists) {
+            pristine.push_back(list->VtxBuffer);
+        }
+
+        recording_gl::setExtensions("GL_ARB_vertex_array_object");
+        recording_gl::loseContext();
+        ImGuiRenderer renderer;
+
+        auto warmup = renderFrame(renderer, *fixture, pristine);
+        BENCH_CHECK(warmup.errors == 0);
+        BENCH_CHECK(warmup.bufferAllocations == 2);
+
+        auto frame = renderFrame(renderer, *fixture, pristine);
+        BENCH_CHECK(frame.errors == 0);
+        BENCH_CHECK(frame.bufferAllocations == 0);
+        BENCH_CHECK(frame.syncStalls == 0);
+        BENCH_CHECK(frame.bufferDataCalls == 2);
+        BENCH_CHECK(frame.bytesUploaded == fixture->bytes);
+        BENCH_CHECK(frame.drawCalls == fixture->visibleCommands);
+        BENCH_CHECK(frame.textureBinds == fixture->textureChanges);
+        BENCH_CHECK(renderer.lastStats().drawCalls == frame.drawCalls);
+        BENCH_CHECK(renderer.lastStats().bufferOrphans == 2);
+
+        measure(options, "render/frame " + std::to_string(size) + " quads", size, [&] {
+            resetVertices(*fixture, pristine);
+            renderer.renderDrawData(&fixture->data);
+        });
+
+        // fullscreen toggle on Windows: destroy, new context, setup
+        renderer.destroy();
+        BENCH_CHECK(recording_gl::liveObjects() == 0);
+        recording_gl::loseContext();
+        auto rebuilt = renderFrame(renderer, *fixture, pristine);
+        BENCH_CHECK(rebuilt.errors == 0);
+        BENCH_CHECK(rebuilt.bufferAllocations == 2);
+        BENCH_CHECK(rebuilt.drawCalls == fixture->visibleCommands);
+
+        // and what happens if the objects outlive their context
+        recording_gl::loseContext();
+        auto stale = renderFrame(renderer, *fixture, pristine);
+        BENCH_CHECK(stale.errors > 0);
+        renderer.destroy();
+
+        recording_gl::setExtensions("");
+        recording_gl::loseContext();
+        ImGuiRenderer fallback;
+        auto fallbackFrame = renderFrame(fallback, *fixture, pristine);
+        BENCH_CHECK(fallbackFrame.errors == 0);
+        BENCH_CHECK(recording_gl::liveObjects() == 0);
+        BENCH_CHECK(fallbackFrame.drawCalls == fixture->visibleTriangles);
+        if (!options.quick) {
+            measure(options, "render/fallback frame " + std::to_string(size) + " quads", size, [&] {
+                resetVertices(*fixture, pristine);
+                fallback.renderDrawData(&fixture->data);
+            });
+        }
+    }
+}
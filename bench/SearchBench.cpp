@@ -0,0 +1,92 @@
+#include "Bench.hpp"
+#include "MockNode.hpp"
+#include "../src/SearchWorker.hpp"
+#include <string>
+
+namespace {
+    // search() is what the worker thread runs, called directly here to time it without the thread
+    class BenchSearchWorker : public SearchWorker {
+    public:
+        using SearchWorker::Job;
+        using SearchWorker::search;
+    };
+
+    size_t countMatches(MockNode* node, MockNode* parent, MockNode* grandparent, auto&& pred) {
+        size_t count = pred(node, parent, grandparent) ? 1 : 0;
+        for (auto& child : node->children) {
+            count += countMatches(child.get(), node, parent, pred);
+        }
+        return count;
+    }
+
+    struct Query {
+        char const* source;
+        // expected matches, worked out on the mock tree directly
+        bool(*expected)(MockNode* node, MockNode* parent, MockNode* grandparent);
+    };
+
+    constexpr Query QUERIES[] = {
+        { "button", [](MockNode* node, MockNode*, MockNode*) {
+            return node->className.find("button") != std::string_view::npos || node->id.find("button") != std::string::npos;
+        } },
+        { "class:CCMenuItemSpriteExtra", [](MockNode* node, MockNode*, MockNode*) {
+            return node->className == "ccmenuitemspriteextra";
+        } },
+        { "id:*-button tag:5", [](MockNode* node, MockNode*, MockNode*) {
+            return node->id.ends_with("-button") && node->tag == 5;
+        } },
+        { "visible:false children>3", [](MockNode* node, MockNode*, MockNode*) {
+            return !node->visible && node->children.size() > 3;
+        } },
+        { "MenuLayer > CCMenu > *", [](MockNode*, MockNode* parent, MockNode* grandparent) {
+            return parent && grandparent && parent->className == "cocos2d::ccmenu" && grandparent->className == "menulayer";
+        } },
+        { "MenuLayer>CCMenu>*", [](MockNode*, MockNode* parent, MockNode* grandparent) {
+            return parent && grandparent && parent->className == "cocos2d::ccmenu" && grandparent->className == "menulayer";
+        } },
+        { "CCMenu >> CCLabelBMFont", nullptr },
+    };
+}
+
+void benchSearch(BenchOptions const& options) {
+    for (auto size : options.sizes) {
+        auto tree = makeSyntheticTree(size);
+
+        SceneSnapshot snapshot;
+        measure(options, "search/snapshot " + std::to_string(size), size, [&] {
+            snapshot.clear();
+            snapshot.nodes.reserve(size);
+            uint64_t identity = 1;
+            snapshotMockTree(tree.get(), SceneSnapshot::NO_PARENT, snapshot, identity);
+        });
+        BENCH_CHECK(snapshot.nodes.size() == size);
+
+        BenchSearchWorker worker;
+        for (auto& query : QUERIES) {
+            std::string error;
+            auto compiled = NodeQuery::parse(query.source, &error);
+            BENCH_CHECK(compiled.has_value());
+            if (!compiled) continue;
+
+            BenchSearchWorker::Job job {
+                .request = 0,
+                .query = std::move(*compiled),
+                .snapshot = std::move(snapshot),
+            };
+            size_t matches = 0;
+            measure(options, std::string("search/\"") + query.source + "\" " + std::to_string(size), size, [&] {
+                SearchResult result;
+                worker.search(job, result);
+                matches = result.matches.size();
+                job.snapshot = std::move(result.snapshot);
+            });
+            snapshot = std::move(job.snapshot);
+
+            if (options.quick && query.expected) {
+                auto expected = countMatches(tree.get(), nullptr, nullptr, query.expected);
+                BENCH_CHECK(matches == expected);
+                BENCH_CHECK(expected > 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#include "Bench.hpp"
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+
+// devtools-bench [--quick] [suite...]
+int main(int argc, char** argv) {
+    BenchOptions options;
+    std::vector<std::string_view> suites;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--quick") == 0) {
+            options.quick = true;
+        }
+        else {
+            suites.push_back(argv[i]);
+        }
+    }
+    if (options.quick) {
+        options.sizes = { 1'000 };
+    }
+    else {
+        options.sizes = { 1'000, 10'000, 100'000, 1'000'000 };
+    }
+
+    auto wanted = [&](std::string_view suite) {
+        return suites.empty() || std::find(suites.begin(), suites.end(), suite) != suites.end();
+    };
+    if (wanted("search")) benchSearch(options);
+    if (wanted("labels")) benchLabels(options);
+    if (wanted("memory")) benchMemoryScan(options);
+    if (wanted("render")) benchRender(options);
+
+    if (g_benchFailures) {
+        std::fprintf(stderr, "%d checks failed\n", g_benchFailures);
+        return 1;
+    }
+    return 0;
+}
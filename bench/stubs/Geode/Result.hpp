@@ -0,0 +1,51 @@
+#pragma once
+
+// The part of geode::Result the sources built here use
+
+#include <string>
+#include <utility>
+#include <variant>
+
+namespace geode {
+    template <class T = void, class E = std::string>
+    class Result {
+    protected:
+        std::variant<T, E> m_value;
+
+    public:
+        Result(std::variant<T, E> value) : m_value(std::move(value)) {}
+
+        bool isOk() const { return m_value.index() == 0; }
+        explicit operator bool() const { return this->isOk(); }
+
+        T& unwrap() & { return std::get<0>(m_value); }
+        T const& unwrap() const& { return std::get<0>(m_value); }
+        T unwrap() && { return std::get<0>(std::move(m_value)); }
+        E const& unwrapErr() const { return std::get<1>(m_value); }
+        T unwrapOr(T fallback) const { return this->isOk() ? std::get<0>(m_value) : std::move(fallback); }
+    };
+
+    template <class E>
+    class Result<void, E> {
+    protected:
+        bool m_ok;
+        E m_error;
+
+    public:
+        Result(bool ok, E error) : m_ok(ok), m_error(std::move(error)) {}
+
+        bool isOk() const { return m_ok; }
+        explicit operator bool() const { return m_ok; }
+        E const& unwrapErr() const { return m_error; }
+    };
+
+    template <class T, class E = std::string>
+    Result<T, E> Ok(T value) {
+        return Result<T, E>(std::variant<T, E>(std::in_place_index<0>, std::move(value)));
+    }
+
+    template <class T, class E>
+    Result<T, E> Err(E error) {
+        return Result<T, E>(std::variant<T, E>(std::in_place_index<1>, std::move(error)));
+    }
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+#include <cstdint>
+#include <cocos2d.h>
@@ -0,0 +1,7 @@
+#pragma once
+
+// Nothing gets hooked here, a $modify class is just a subclass nobody creates
+
+#include <cocos2d.h>
+
+#define $modify(name, base) name : public base
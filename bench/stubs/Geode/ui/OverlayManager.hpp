@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cocos2d.h>
+
+namespace geode {
+    class OverlayManager : public cocos2d::CCNode {
+    public:
+        static OverlayManager* get();
+    };
+}
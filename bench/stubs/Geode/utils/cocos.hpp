@@ -0,0 +1,57 @@
+#pragma once
+
+// The Geode utilities the inspection server and JSON export use, implemented in MockCocos.cpp
+
+#include <Geode/Result.hpp>
+#include <cocos2d.h>
+#include <filesystem>
+#include <fmt/format.h>
+
+namespace geode {
+    class Mod {
+    public:
+        static Mod* get();
+        std::filesystem::path getSaveDir() const;
+    };
+
+    namespace log {
+        template <class... Args>
+        void error(fmt::format_string<Args...> format, Args&&... args) {
+            fmt::print(stderr, "[error] {}\n", fmt::format(format, std::forward<Args>(args)...));
+        }
+
+        template <class... Args>
+        void info(fmt::format_string<Args...>, Args&&...) {}
+    }
+
+    template <class T>
+    T typeinfo_cast(auto* object) {
+        return dynamic_cast<T>(object);
+    }
+
+    template <class T>
+    class CCArrayExt {
+    protected:
+        cocos2d::CCArray* m_array;
+
+    public:
+        class iterator {
+        public:
+            cocos2d::CCObject* const* m_item;
+
+            T operator*() const { return static_cast<T>(*m_item); }
+            iterator& operator++() { ++m_item; return *this; }
+            bool operator!=(iterator const& other) const { return m_item != other.m_item; }
+        };
+
+        CCArrayExt(cocos2d::CCArray* array) : m_array(array) {}
+
+        iterator begin() const { return { m_array ? m_array->data.data() : nullptr }; }
+        iterator end() const { return { m_array ? m_array->data.data() + m_array->data.size() : nullptr }; }
+    };
+
+    namespace prelude {
+        using namespace ::geode;
+        using namespace ::cocos2d;
+    }
+}
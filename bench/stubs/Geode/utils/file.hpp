@@ -0,0 +1,9 @@
+#pragma once
+
+#include <Geode/Result.hpp>
+#include <filesystem>
+#include <string>
+
+namespace geode::utils::file {
+    Result<void> writeString(std::filesystem::path const& path, std::string const& data);
+}
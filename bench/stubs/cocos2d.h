@@ -0,0 +1,232 @@
+#pragma once
+
+// The GL and cocos bits ImGuiRenderer uses. The GL functions are implemented by
+// the recording GL in RecordingGL.cpp, the cocos ones forward to it as well.
+// Below that is a bare node tree for the inspection server test, implemented in MockCocos.cpp.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+typedef unsigned int GLenum;
+typedef unsigned int GLuint;
+typedef int GLint;
+typedef int GLsizei;
+typedef unsigned char GLboolean;
+typedef unsigned char GLubyte;
+typedef float GLfloat;
+typedef void GLvoid;
+typedef std::ptrdiff_t GLintptr;
+typedef std::ptrdiff_t GLsizeiptr;
+
+#define GL_FALSE 0
+#define GL_TRUE 1
+#define GL_TRIANGLES 0x0004
+#define GL_TRIANGLE_FAN 0x0006
+#define GL_UNSIGNED_BYTE 0x1401
+#define GL_UNSIGNED_SHORT 0x1403
+#define GL_FLOAT 0x1406
+#define GL_EXTENSIONS 0x1F03
+#define GL_SCISSOR_TEST 0x0C11
+#define GL_ARRAY_BUFFER 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER 0x8893
+#define GL_STREAM_DRAW 0x88E0
+
+GLubyte const* glGetString(GLenum name);
+void glEnable(GLenum cap);
+void glDisable(GLenum cap);
+void glGenVertexArrays(GLsizei n, GLuint* arrays);
+void glBindVertexArray(GLuint array);
+void glDeleteVertexArrays(GLsizei n, GLuint const* arrays);
+void glGenBuffers(GLsizei n, GLuint* buffers);
+void glBindBuffer(GLenum target, GLuint buffer);
+void glDeleteBuffers(GLsizei n, GLuint const* buffers);
+void glBufferData(GLenum target, GLsizeiptr size, void const* data, GLenum usage);
+void glBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void const* data);
+void glEnableVertexAttribArray(GLuint index);
+void glVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, void const* pointer);
+void glDrawElements(GLenum mode, GLsizei count, GLenum type, void const* indices);
+void glDrawArrays(GLenum mode, GLint first, GLsizei count);
+
+namespace cocos2d {
+    struct CCPoint {
+        float x = 0.f, y = 0.f;
+        CCPoint() = default;
+        CCPoint(float x, float y) : x(x), y(y) {}
+    };
+
+    struct CCSize {
+        float width = 0.f, height = 0.f;
+        CCSize() = default;
+        CCSize(float width, float height) : width(width), height(height) {}
+    };
+
+    struct ccVertex2F {
+        GLfloat x, y;
+    };
+
+    struct ccColor4F {
+        GLfloat r, g, b, a;
+    };
+
+    inline ccColor4F ccc4f(GLfloat r, GLfloat g, GLfloat b, GLfloat a) {
+        return { r, g, b, a };
+    }
+
+    inline CCPoint ccp(float x, float y) {
+        return CCPoint(x, y);
+    }
+
+    enum {
+        kCCVertexAttrib_Position,
+        kCCVertexAttrib_Color,
+        kCCVertexAttrib_TexCoords,
+    };
+
+    enum {
+        kCCVertexAttribFlag_PosColorTex = 7,
+    };
+
+    inline constexpr char const* kCCShader_PositionTextureColor = "ShaderPositionTextureColor";
+
+    class CCGLProgram {
+    public:
+        void use() {}
+        void setUniformsForBuiltins() {}
+    };
+
+    class CCShaderCache {
+    public:
+        static CCShaderCache* sharedShaderCache();
+        CCGLProgram* programForKey(char const* key);
+    };
+
+    class CCEGLView {
+    public:
+        void setScissorInPoints(float x, float y, float w, float h);
+    };
+
+    struct ccColor3B {
+        GLubyte r = 255, g = 255, b = 255;
+    };
+
+    class CCObject {
+    public:
+        virtual ~CCObject() = default;
+    };
+
+    class CCArray : public CCObject {
+    public:
+        std::vector<CCObject*> data;
+
+        unsigned int count() const { return static_cast<unsigned int>(data.size()); }
+        CCObject* objectAtIndex(unsigned int index) const { return data[index]; }
+    };
+
+    class Layout : public CCObject {};
+    class LayoutOptions : public CCObject {};
+
+    // Owns its children, the setters go through the same journal and setter hooks the real ones do
+    class CCNode : public CCObject {
+    protected:
+        CCArray* m_pChildren = nullptr;
+        CCNode* m_pParent = nullptr;
+        std::string m_id;
+        CCPoint m_obPosition;
+        CCPoint m_obAnchorPoint;
+        CCSize m_obContentSize;
+        float m_fScaleX = 1.f, m_fScaleY = 1.f;
+        float m_fRotationX = 0.f, m_fRotationY = 0.f;
+        float m_fSkewX = 0.f, m_fSkewY = 0.f;
+        int m_nZOrder = 0;
+        int m_nTag = -1;
+        bool m_bVisible = true;
+
+    public:
+        ~CCNode() override;
+
+        CCArray* getChildren() { return m_pChildren; }
+        unsigned int getChildrenCount() const { return m_pChildren ? m_pChildren->count() : 0; }
+        CCNode* getParent() { return m_pParent; }
+
+        void addChild(CCNode* child);
+        // Unlinks the child without destroying it
+        void removeChild(CCNode* child);
+        void reorderChild(CCNode* child, int zOrder);
+
+        std::string const& getID() const { return m_id; }
+        void setID(std::string const& id);
+
+        float getPositionX() { return m_obPosition.x; }
+        float getPositionY() { return m_obPosition.y; }
+        void setPosition(float x, float y);
+        float getScaleX() { return m_fScaleX; }
+        float getScaleY() { return m_fScaleY; }
+        void setScaleX(float scale);
+        void setScaleY(float scale);
+        float getRotationX() { return m_fRotationX; }
+        float getRotationY() { return m_fRotationY; }
+        void setRotation(float rotation);
+        float getSkewX() { return m_fSkewX; }
+        float getSkewY() { return m_fSkewY; }
+        void setSkewX(float skew);
+        void setSkewY(float skew);
+        CCPoint const& getAnchorPoint() { return m_obAnchorPoint; }
+        void setAnchorPoint(CCPoint const& point);
+        float getContentWidth() { return m_obContentSize.width; }
+        float getContentHeight() { return m_obContentSize.height; }
+        void setContentSize(CCSize const& size);
+        bool isVisible() { return m_bVisible; }
+        void setVisible(bool visible);
+        int getZOrder() { return m_nZOrder; }
+        void setZOrder(int zOrder);
+        int getTag() const { return m_nTag; }
+        void setTag(int tag);
+        bool isIgnoreAnchorPointForPosition() { return false; }
+        Layout* getLayout() { return nullptr; }
+        LayoutOptions* getLayoutOptions() { return nullptr; }
+        void updateLayout() {}
+    };
+
+    class CCRGBAProtocol {
+    public:
+        virtual ~CCRGBAProtocol() = default;
+        virtual void setOpacity(GLubyte opacity) = 0;
+        virtual GLubyte getOpacity() = 0;
+        virtual ccColor3B const& getColor() = 0;
+    };
+
+    class CCNodeRGBA : public CCNode, public CCRGBAProtocol {
+    protected:
+        ccColor3B m_tColor;
+        GLubyte m_nOpacity = 255;
+
+    public:
+        void setOpacity(GLubyte opacity) override;
+        GLubyte getOpacity() override { return m_nOpacity; }
+        ccColor3B const& getColor() override { return m_tColor; }
+    };
+
+    class CCScene : public CCNode {};
+
+    class CCScheduler : public CCObject {
+    public:
+        virtual void update(float dt) {}
+    };
+
+    class CCDirector {
+    protected:
+        CCScene* m_pRunningScene = nullptr;
+
+    public:
+        static CCDirector* sharedDirector();
+        static CCDirector* get();
+        CCEGLView* getOpenGLView();
+        CCSize getWinSize();
+        CCScene* getRunningScene() { return m_pRunningScene; }
+        void setRunningScene(CCScene* scene) { m_pRunningScene = scene; }
+    };
+
+    void ccGLBindTexture2D(GLuint textureId);
+    void ccGLEnableVertexAttribs(unsigned int flags);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+// Just the draw data part of ImGui 1.92, enough for building ImDrawData fixtures
+// and running ImGuiRenderer against them without the real library
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+typedef unsigned int ImU32;
+typedef unsigned long long ImU64;
+typedef unsigned short ImDrawIdx;
+typedef ImU64 ImTextureID;
+#define ImTextureID_Invalid ((ImTextureID)0)
+
+struct ImVec2 {
+    float x = 0.f, y = 0.f;
+    constexpr ImVec2() = default;
+    constexpr ImVec2(float x, float y) : x(x), y(y) {}
+};
+
+struct ImVec4 {
+    float x = 0.f, y = 0.f, z = 0.f, w = 0.f;
+    constexpr ImVec4() = default;
+    constexpr ImVec4(float x, float y, float z, float w) : x(x), y(y), z(z), w(w) {}
+};
+
+struct ImColor {
+    ImVec4 Value;
+    ImColor(ImU32 rgba) : Value(
+        static_cast<float>(rgba & 0xff) / 255.f,
+        static_cast<float>((rgba >> 8) & 0xff) / 255.f,
+        static_cast<float>((rgba >> 16) & 0xff) / 255.f,
+        static_cast<float>((rgba >> 24) & 0xff) / 255.f
+    ) {}
+};
+
+// std::vector underneath, with ImVector's field names
+template <class T>
+struct ImVector {
+    std::vector<T> storage;
+    T* Data = nullptr;
+    int Size = 0;
+
+    ImVector() = default;
+    ImVector(ImVector const& other) : storage(other.storage) { this->sync(); }
+    ImVector& operator=(ImVector const& other) {
+        storage = other.storage;
+        this->sync();
+        return *this;
+    }
+
+    void sync() {
+        Data = storage.data();
+        Size = static_cast<int>(storage.size());
+    }
+    void push_back(T const& value) {
+        storage.push_back(value);
+        this->sync();
+    }
+    int size() const { return Size; }
+    T* begin() { return Data; }
+    T* end() { return Data + Size; }
+    T const* begin() const { return Data; }
+    T const* end() const { return Data + Size; }
+    T& operator[](int i) { return Data[i]; }
+    T const& operator[](int i) const { return Data[i]; }
+};
+
+struct ImDrawVert {
+    ImVec2 pos;
+    ImVec2 uv;
+    ImU32 col;
+};
+
+struct ImDrawCmd {
+    ImVec4 ClipRect;
+    ImTextureID TexID = ImTextureID_Invalid;
+    unsigned int VtxOffset = 0;
+    unsigned int IdxOffset = 0;
+    unsigned int ElemCount = 0;
+
+    ImTextureID GetTexID() const { return TexID; }
+};
+
+struct ImDrawList {
+    ImVector<ImDrawCmd> CmdBuffer;
+    ImVector<ImDrawIdx> IdxBuffer;
+    ImVector<ImDrawVert> VtxBuffer;
+};
+
+struct ImDrawData {
+    int CmdListsCount = 0;
+    ImVector<ImDrawList*> CmdLists;
+    ImVec2 DisplayPos;
+    ImVec2 DisplaySize;
+    ImVec2 FramebufferScale = ImVec2(1.f, 1.f);
+};
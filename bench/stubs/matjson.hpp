@@ -0,0 +1,38 @@
+#pragma once
+
+// Enough of matjson to parse what the inspection server and its test read
+
+#include <Geode/Result.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace matjson {
+    enum class Type { Null, Bool, Number, String, Array, Object };
+
+    class Value {
+    public:
+        Type type = Type::Null;
+        bool boolean = false;
+        double number = 0.0;
+        std::string string;
+        std::vector<Value> array;
+        std::map<std::string, Value, std::less<>> object;
+
+        Value const& operator[](std::string_view key) const;
+        Value const& operator[](size_t index) const;
+        bool contains(std::string_view key) const;
+        size_t size() const;
+        bool isNull() const { return type == Type::Null; }
+
+        geode::Result<std::string> asString() const;
+        geode::Result<intmax_t> asInt() const;
+        geode::Result<double> asDouble() const;
+        geode::Result<bool> asBool() const;
+    };
+
+    geode::Result<Value> parse(std::string_view source);
+}
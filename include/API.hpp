@@ -33,6 +33,12 @@ namespace devtools {
         using Event::Event;
     };
 
+    // Same as RegisterNodeEvent, but also tells DevTools which nodes the callback is for,
+    // so it only has to check each type once
+    struct RegisterTypedNodeEvent final : geode::Event<RegisterTypedNodeEvent, bool(bool(*)(cocos2d::CCNode*), geode::Function<void(cocos2d::CCNode*)>&)> {
+        using Event::Event;
+    };
+
     template <typename T>
     struct PropertyFnEvent final : geode::Event<PropertyFnEvent<T>, bool(bool(*&)(geode::ZStringView name, T&))> {
         using Fn = bool(geode::ZStringView name, T&);
@@ -87,8 +93,14 @@ namespace devtools {
                 callback(casted);
             }
         };
+        auto matches = +[](cocos2d::CCNode* node) {
+            return geode::cast::typeinfo_cast<std::remove_pointer_t<T>*>(node) != nullptr;
+        };
 
-        RegisterNodeEvent().send(func);
+        // versions of DevTools from before the typed event only listen for the plain one
+        if (!RegisterTypedNodeEvent().send(matches, func)) {
+            RegisterNodeEvent().send(func);
+        }
     }
 
     /// @brief Renders a property editor for the given value in the DevTools UI.
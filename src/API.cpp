@@ -19,7 +19,9 @@ static void handleType() {
             isSigned ? ImGuiDataType_S64 : ImGuiDataType_U64;
         fnPtr = +[](ZStringView name, T& prop) {
             DevTools::get()->setUsedAPI(true);
-            return ImGui::DragScalar(name.c_str(), dataType, &prop);
+            auto changed = ImGui::DragScalar(name.c_str(), dataType, &prop);
+            DevTools::get()->watchProperty(name.c_str(), static_cast<float>(prop));
+            return changed;
         };
         return ListenerResult::Stop;
     }).leak();
@@ -99,6 +101,10 @@ $execute {
         DevTools::get()->addCustomCallback(std::move(callback));
         return ListenerResult::Stop;
     }).leak();
+    devtools::RegisterTypedNodeEvent().listen([](bool(*matches)(CCNode*), Function<void(CCNode*)>& callback) {
+        DevTools::get()->addCustomCallback(std::move(callback), matches);
+        return ListenerResult::Stop;
+    }).leak();
 
     // Scalars & Enums
     handleType<char>();
@@ -0,0 +1,225 @@
+#include "BinarySnapshot.hpp"
+#include "platform/utils.hpp"
+#include <Geode/utils/cocos.hpp>
+#include <Geode/ui/Layout.hpp>
+#include <Geode/ui/SimpleAxisLayout.hpp>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <unordered_map>
+
+using namespace geode::prelude;
+namespace bs = binary_snapshot;
+
+namespace {
+    constexpr float UNSET = std::numeric_limits<float>::quiet_NaN();
+
+    float optional(std::optional<float> value) {
+        return value.value_or(UNSET);
+    }
+
+    struct Writer {
+        std::vector<bs::Node> nodes;
+        std::vector<bs::LayoutOptions> layoutOptions;
+        std::vector<uint32_t> stringOffsets = { 0 };
+        std::string stringData;
+        std::unordered_map<std::string, uint32_t> strings = { { "", 0 } };
+
+        uint32_t intern(std::string_view str) {
+            auto [it, inserted] = strings.try_emplace(std::string(str), static_cast<uint32_t>(strings.size()));
+            if (inserted) {
+                stringOffsets.push_back(static_cast<uint32_t>(stringData.size()));
+                stringData.append(str);
+            }
+            return it->second;
+        }
+
+        uint32_t writeLayoutOptions(cocos2d::LayoutOptions* rawOpts) {
+            bs::LayoutOptions out {};
+            out.className = this->intern(getObjectClassName(rawOpts));
+            std::fill(std::begin(out.values), std::end(out.values), UNSET);
+
+            if (auto opts = typeinfo_cast<SimpleAxisLayoutOptions*>(rawOpts)) {
+                out.kind = bs::LayoutOptionsKind::SimpleAxis;
+                out.values[0] = optional(opts->getMinRelativeScale());
+                out.values[1] = optional(opts->getMaxRelativeScale());
+                out.values[2] = static_cast<float>(opts->getScalingPriority());
+            }
+            else if (auto opts = typeinfo_cast<AxisLayoutOptions*>(rawOpts)) {
+                out.kind = bs::LayoutOptionsKind::Axis;
+                if (auto autoScale = opts->getAutoScale()) {
+                    out.flags |= 1;
+                    if (*autoScale) out.flags |= 2;
+                }
+                if (opts->getBreakLine()) out.flags |= 4;
+                if (opts->getSameLine()) out.flags |= 8;
+                out.values[0] = optional(opts->getLength());
+                out.values[1] = optional(opts->getPrevGap());
+                out.values[2] = optional(opts->getNextGap());
+                out.values[3] = opts->getRelativeScale();
+                out.values[4] = opts->getMinScale();
+                out.values[5] = opts->getMaxScale();
+                out.values[6] = static_cast<float>(opts->getScalePriority());
+                if (auto align = opts->getCrossAxisAlignment()) {
+                    out.values[7] = static_cast<float>(*align);
+                }
+            }
+            else if (auto opts = typeinfo_cast<AnchorLayoutOptions*>(rawOpts)) {
+                out.kind = bs::LayoutOptionsKind::Anchor;
+                out.values[0] = opts->getOffset().x;
+                out.values[1] = opts->getOffset().y;
+                out.values[2] = static_cast<float>(opts->getAnchor());
+            }
+
+            layoutOptions.push_back(out);
+            return static_cast<uint32_t>(layoutOptions.size() - 1);
+        }
+
+        void writeNode(CCNode* node, uint32_t parent) {
+            auto index = static_cast<uint32_t>(nodes.size());
+            bs::Node out {};
+            out.parent = parent;
+            out.childCount = node->getChildrenCount();
+            out.className = this->intern(getObjectClassName(node));
+            out.id = this->intern(node->getID());
+            out.layout = node->getLayout() ? this->intern(getObjectClassName(node->getLayout())) : bs::NONE;
+            out.layoutOptions = node->getLayoutOptions() ? this->writeLayoutOptions(node->getLayoutOptions()) : bs::NONE;
+            out.tag = node->getTag();
+            out.zOrder = node->getZOrder();
+            out.x = node->getPositionX();
+            out.y = node->getPositionY();
+            out.scaleX = node->getScaleX();
+            out.scaleY = node->getScaleY();
+            out.rotationX = node->getRotationX();
+            out.rotationY = node->getRotationY();
+            out.skewX = node->getSkewX();
+            out.skewY = node->getSkewY();
+            out.anchorX = node->getAnchorPoint().x;
+            out.anchorY = node->getAnchorPoint().y;
+            out.width = node->getContentWidth();
+            out.height = node->getContentHeight();
+            out.opacity = 255;
+            if (node->isVisible()) out.flags |= bs::Visible;
+            if (node->isIgnoreAnchorPointForPosition()) out.flags |= bs::IgnoreAnchorPointForPosition;
+            if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+                auto color = rgba->getColor();
+                out.color[0] = color.r;
+                out.color[1] = color.g;
+                out.color[2] = color.b;
+                out.opacity = rgba->getOpacity();
+                out.flags |= bs::HasColor;
+            }
+            nodes.push_back(out);
+
+            for (auto child : CCArrayExt<CCNode*>(node->getChildren())) {
+                this->writeNode(child, index);
+            }
+            nodes[index].subtreeSize = static_cast<uint32_t>(nodes.size() - index);
+        }
+    };
+
+    template <class T>
+    bool viewArray(std::span<uint8_t const> file, uint64_t offset, uint32_t count, std::span<T const>& out) {
+        if (offset % alignof(T) != 0 || offset > file.size() || (file.size() - offset) / sizeof(T) < count) {
+            return false;
+        }
+        out = { reinterpret_cast<T const*>(file.data() + offset), count };
+        return true;
+    }
+}
+
+std::string writeBinarySnapshot(CCNode* root, std::filesystem::path const& path) {
+    if (!root) return "Nothing to export";
+
+    Writer writer;
+    writer.writeNode(root, bs::NONE);
+    writer.stringOffsets.push_back(static_cast<uint32_t>(writer.stringData.size()));
+
+    bs::Header header {};
+    std::memcpy(header.magic, bs::MAGIC, sizeof(bs::MAGIC));
+    header.version = bs::VERSION;
+    header.nodeCount = static_cast<uint32_t>(writer.nodes.size());
+    header.layoutOptionsCount = static_cast<uint32_t>(writer.layoutOptions.size());
+    // the offsets array has one extra entry marking the end of the last string
+    header.stringCount = static_cast<uint32_t>(writer.stringOffsets.size() - 1);
+    header.stringDataSize = static_cast<uint32_t>(writer.stringData.size());
+    header.nodesOffset = sizeof(bs::Header);
+    header.layoutOptionsOffset = header.nodesOffset + writer.nodes.size() * sizeof(bs::Node);
+    header.stringOffsetsOffset = header.layoutOptionsOffset + writer.layoutOptions.size() * sizeof(bs::LayoutOptions);
+    header.stringDataOffset = header.stringOffsetsOffset + writer.stringOffsets.size() * sizeof(uint32_t);
+
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) return "Unable to open file for writing";
+
+    file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+    file.write(reinterpret_cast<char const*>(writer.nodes.data()), writer.nodes.size() * sizeof(bs::Node));
+    file.write(reinterpret_cast<char const*>(writer.layoutOptions.data()), writer.layoutOptions.size() * sizeof(bs::LayoutOptions));
+    file.write(reinterpret_cast<char const*>(writer.stringOffsets.data()), writer.stringOffsets.size() * sizeof(uint32_t));
+    file.write(writer.stringData.data(), writer.stringData.size());
+    if (!file) return "Unable to write file";
+    return "";
+}
+
+BinarySnapshot BinarySnapshot::open(std::filesystem::path const& path, std::string* error) {
+    BinarySnapshot ret;
+    auto fail = [&](std::string what) {
+        if (error) *error = std::move(what);
+        return BinarySnapshot();
+    };
+
+    std::string mapError;
+    ret.m_file = MappedFile::open(path, &mapError);
+    if (!ret.m_file.isOpen()) {
+        return fail(mapError);
+    }
+
+    auto data = ret.m_file.data();
+    if (data.size() < sizeof(bs::Header)) {
+        return fail("File is too small to be a snapshot");
+    }
+    auto header = reinterpret_cast<bs::Header const*>(data.data());
+    if (std::memcmp(header->magic, bs::MAGIC, sizeof(bs::MAGIC)) != 0) {
+        return fail("Not a DevTools snapshot");
+    }
+    if (header->version != bs::VERSION) {
+        return fail(fmt::format("Unsupported snapshot version {}", header->version));
+    }
+
+    std::span<uint8_t const> stringData;
+    if (
+        header->stringCount == 0 ||
+        !viewArray(data, header->nodesOffset, header->nodeCount, ret.m_nodes) ||
+        !viewArray(data, header->layoutOptionsOffset, header->layoutOptionsCount, ret.m_layoutOptions) ||
+        !viewArray(data, header->stringOffsetsOffset, header->stringCount + 1, ret.m_stringOffsets) ||
+        !viewArray(data, header->stringDataOffset, header->stringDataSize, stringData)
+    ) {
+        return fail("Snapshot is truncated or corrupted");
+    }
+    ret.m_stringData = std::string_view(reinterpret_cast<char const*>(stringData.data()), stringData.size());
+    ret.m_header = header;
+    return ret;
+}
+
+bool BinarySnapshot::isOpen() const {
+    return m_header != nullptr;
+}
+
+std::span<bs::Node const> BinarySnapshot::nodes() const {
+    return m_nodes;
+}
+
+bs::LayoutOptions const* BinarySnapshot::getLayoutOptions(bs::Node const& node) const {
+    if (node.layoutOptions >= m_layoutOptions.size()) return nullptr;
+    return &m_layoutOptions[node.layoutOptions];
+}
+
+std::string_view BinarySnapshot::getString(uint32_t index) const {
+    if (index >= m_stringOffsets.size() - 1) return "";
+    auto start = m_stringOffsets[index];
+    auto end = m_stringOffsets[index + 1];
+    if (start > end || end > m_stringData.size()) return "";
+    return m_stringData.substr(start, end - start);
+}
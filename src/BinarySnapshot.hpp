@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <cocos2d.h>
+#include "platform/MappedFile.hpp"
+
+// On-disk format of exported scene snapshots, read back in place through a memory mapping.
+//
+// The file is a header followed by flat arrays of the structs below, all little endian:
+// nodes in depth-first order, layout options, string offsets and the string data.
+// Class names and IDs are interned in the string table, index 0 is always the empty string.
+// A node's children start right after it, and each child is followed by its own subtree.
+namespace binary_snapshot {
+    static constexpr char MAGIC[4] = { 'D', 'T', 'S', 'N' };
+    static constexpr uint32_t VERSION = 1;
+    static constexpr uint32_t NONE = 0xffffffff;
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t nodeCount;
+        uint32_t layoutOptionsCount;
+        uint32_t stringCount;
+        uint32_t stringDataSize;
+        uint64_t nodesOffset;
+        uint64_t layoutOptionsOffset;
+        uint64_t stringOffsetsOffset;
+        uint64_t stringDataOffset;
+    };
+    static_assert(sizeof(Header) == 56);
+
+    enum NodeFlags : uint8_t {
+        Visible   = 1 << 0,
+        HasColor  = 1 << 1,
+        IgnoreAnchorPointForPosition = 1 << 2,
+    };
+
+    struct Node {
+        uint32_t parent;
+        uint32_t childCount;
+        // this node included
+        uint32_t subtreeSize;
+        uint32_t className;
+        uint32_t id;
+        uint32_t layout;
+        uint32_t layoutOptions;
+        int32_t tag;
+        int32_t zOrder;
+        float x;
+        float y;
+        float scaleX;
+        float scaleY;
+        float rotationX;
+        float rotationY;
+        float skewX;
+        float skewY;
+        float anchorX;
+        float anchorY;
+        float width;
+        float height;
+        uint8_t color[3];
+        uint8_t opacity;
+        uint8_t flags;
+        uint8_t padding[3];
+    };
+    static_assert(sizeof(Node) == 88);
+
+    enum class LayoutOptionsKind : uint8_t {
+        Other,
+        SimpleAxis,
+        Axis,
+        Anchor,
+    };
+
+    // `values` and `flags` depend on the kind:
+    // SimpleAxis: min relative scale, max relative scale, scaling priority
+    // Axis: length, prev gap, next gap, relative scale, min scale, max scale, scale priority, cross axis alignment
+    // Anchor: offset x, offset y, anchor
+    // Optional values that aren't set are NaN.
+    struct LayoutOptions {
+        uint32_t className;
+        LayoutOptionsKind kind;
+        // Axis: 1 = auto scale set, 2 = auto scale, 4 = break line, 8 = same line
+        uint8_t flags;
+        uint8_t padding[2];
+        float values[8];
+    };
+    static_assert(sizeof(LayoutOptions) == 40);
+}
+
+// Writes the tree under `root` to `path`, returns an error message on failure
+std::string writeBinarySnapshot(cocos2d::CCNode* root, std::filesystem::path const& path);
+
+// A snapshot file mapped into memory, nothing is copied out of it
+class BinarySnapshot {
+protected:
+    MappedFile m_file;
+    binary_snapshot::Header const* m_header = nullptr;
+    std::span<binary_snapshot::Node const> m_nodes;
+    std::span<binary_snapshot::LayoutOptions const> m_layoutOptions;
+    std::span<uint32_t const> m_stringOffsets;
+    std::string_view m_stringData;
+
+public:
+    // Fills `error` and returns a closed snapshot if the file isn't a valid snapshot
+    static BinarySnapshot open(std::filesystem::path const& path, std::string* error);
+
+    bool isOpen() const;
+    std::span<binary_snapshot::Node const> nodes() const;
+    // Layout options of a node, or null
+    binary_snapshot::LayoutOptions const* getLayoutOptions(binary_snapshot::Node const& node) const;
+    // Out of range indices give the empty string rather than reading past the file
+    std::string_view getString(uint32_t index) const;
+};
@@ -0,0 +1,188 @@
+#include "CacheIndex.hpp"
+#include <Geode/modify/CCSpriteFrameCache.hpp>
+#include <Geode/modify/CCTextureCache.hpp>
+#include <Geode/utils/cocos.hpp>
+#include <bit>
+#include <functional>
+
+using namespace geode::prelude;
+
+size_t SpriteFrameIndex::KeyHash::operator()(Key const& key) const {
+    auto hash = std::hash<void*>()(key.texture);
+    for (auto value : { key.x, key.y, key.width, key.height }) {
+        hash ^= std::bit_cast<uint32_t>(value) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    return hash;
+}
+
+SpriteFrameIndex* SpriteFrameIndex::get() {
+    static auto inst = new SpriteFrameIndex();
+    return inst;
+}
+
+void SpriteFrameIndex::invalidate() {
+    m_dirty = true;
+}
+
+void SpriteFrameIndex::rebuild(CCDictionary* frames) {
+    m_frames.clear();
+    m_frames.reserve(frames->count());
+    for (auto [name, frame] : CCDictionaryExt<std::string, CCSpriteFrame*>(frames)) {
+        auto rect = frame->getRect();
+        auto key = Key {
+            .texture = frame->getTexture(),
+            .x = rect.origin.x,
+            .y = rect.origin.y,
+            .width = rect.size.width,
+            .height = rect.size.height,
+        };
+        // the first one wins, like the old linear search
+        m_frames.try_emplace(key, Entry { name, frame });
+    }
+    m_indexedDict = frames;
+    m_indexedCount = frames->count();
+    m_dirty = false;
+}
+
+std::string const* SpriteFrameIndex::find(CCTexture2D* texture, CCRect const& rect) {
+    auto frames = CCSpriteFrameCache::sharedSpriteFrameCache()->m_pSpriteFrames;
+    if (!frames) return nullptr;
+    if (m_dirty || frames != m_indexedDict || frames->count() != m_indexedCount) {
+        this->rebuild(frames);
+    }
+
+    auto key = Key {
+        .texture = texture,
+        .x = rect.origin.x,
+        .y = rect.origin.y,
+        .width = rect.size.width,
+        .height = rect.size.height,
+    };
+    auto it = m_frames.find(key);
+    if (it == m_frames.end()) return nullptr;
+
+    // a frame swapped out without going through the hooks
+    auto current = static_cast<CCSpriteFrame*>(frames->objectForKey(it->second.name));
+    if (current != it->second.frame || current->getTexture() != texture || !(current->getRect() == rect)) {
+        this->rebuild(frames);
+        it = m_frames.find(key);
+        if (it == m_frames.end()) return nullptr;
+    }
+    return &it->second.name;
+}
+
+class $modify(SpriteFrameIndexCache, CCSpriteFrameCache) {
+    void addSpriteFramesWithDictionary(CCDictionary* dict, CCTexture2D* texture) {
+        // plists already loaded get loaded again on scene changes, and add nothing then.
+        // Frames replaced under the same names are caught by find checking its hits
+        auto count = m_pSpriteFrames->count();
+        CCSpriteFrameCache::addSpriteFramesWithDictionary(dict, texture);
+        if (m_pSpriteFrames->count() != count) {
+            SpriteFrameIndex::get()->invalidate();
+        }
+    }
+
+    void addSpriteFrame(CCSpriteFrame* frame, char const* name) {
+        CCSpriteFrameCache::addSpriteFrame(frame, name);
+        SpriteFrameIndex::get()->invalidate();
+    }
+
+    void removeSpriteFrames() {
+        CCSpriteFrameCache::removeSpriteFrames();
+        SpriteFrameIndex::get()->invalidate();
+    }
+
+    void removeUnusedSpriteFrames() {
+        CCSpriteFrameCache::removeUnusedSpriteFrames();
+        SpriteFrameIndex::get()->invalidate();
+    }
+
+    void removeSpriteFrameByName(char const* name) {
+        CCSpriteFrameCache::removeSpriteFrameByName(name);
+        SpriteFrameIndex::get()->invalidate();
+    }
+
+    void removeSpriteFramesFromDictionary(CCDictionary* dict) {
+        CCSpriteFrameCache::removeSpriteFramesFromDictionary(dict);
+        SpriteFrameIndex::get()->invalidate();
+    }
+
+    void removeSpriteFramesFromTexture(CCTexture2D* texture) {
+        CCSpriteFrameCache::removeSpriteFramesFromTexture(texture);
+        SpriteFrameIndex::get()->invalidate();
+    }
+};
+
+TextureIndex* TextureIndex::get() {
+    static auto inst = new TextureIndex();
+    return inst;
+}
+
+void TextureIndex::invalidate() {
+    m_dirty = true;
+}
+
+void TextureIndex::added(CCTexture2D* texture) {
+    if (texture && !m_keys.contains(texture)) {
+        m_dirty = true;
+    }
+}
+
+void TextureIndex::rebuild(CCDictionary* textures) {
+    m_keys.clear();
+    m_keys.reserve(textures->count());
+    for (auto [key, texture] : CCDictionaryExt<std::string, CCTexture2D*>(textures)) {
+        m_keys.try_emplace(texture, key);
+    }
+    m_indexedDict = textures;
+    m_indexedCount = textures->count();
+    m_dirty = false;
+}
+
+std::string const* TextureIndex::find(CCTexture2D* texture) {
+    auto textures = CCTextureCache::sharedTextureCache()->m_pTextures;
+    if (!textures) return nullptr;
+    if (m_dirty || textures != m_indexedDict || textures->count() != m_indexedCount) {
+        this->rebuild(textures);
+    }
+
+    // plenty of textures (render textures, labels) are never cached, so a miss is normal
+    auto it = m_keys.find(texture);
+    if (it == m_keys.end()) return nullptr;
+
+    if (textures->objectForKey(it->second) != texture) {
+        this->rebuild(textures);
+        it = m_keys.find(texture);
+        if (it == m_keys.end()) return nullptr;
+    }
+    return &it->second;
+}
+
+class $modify(TextureIndexCache, CCTextureCache) {
+    CCTexture2D* addImage(char const* path, bool removeOnDealloc) {
+        auto texture = CCTextureCache::addImage(path, removeOnDealloc);
+        // almost always a cache hit
+        TextureIndex::get()->added(texture);
+        return texture;
+    }
+
+    void removeTexture(CCTexture2D* texture) {
+        CCTextureCache::removeTexture(texture);
+        TextureIndex::get()->invalidate();
+    }
+
+    void removeTextureForKey(char const* key) {
+        CCTextureCache::removeTextureForKey(key);
+        TextureIndex::get()->invalidate();
+    }
+
+    void removeAllTextures() {
+        CCTextureCache::removeAllTextures();
+        TextureIndex::get()->invalidate();
+    }
+
+    void removeUnusedTextures() {
+        CCTextureCache::removeUnusedTextures();
+        TextureIndex::get()->invalidate();
+    }
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <cocos2d.h>
+
+// Reverse lookup of CCSpriteFrameCache, from a texture and rect to the name of the frame.
+// Hooks on the cache mark the index dirty and it's rebuilt on the next lookup, the frame
+// count and a check of every hit against the cache catch changes made behind its back.
+class SpriteFrameIndex {
+protected:
+    struct Key {
+        cocos2d::CCTexture2D* texture;
+        float x, y, width, height;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(Key const& key) const;
+    };
+
+    struct Entry {
+        std::string name;
+        // only compared against what the cache holds under that name
+        cocos2d::CCSpriteFrame* frame;
+    };
+
+    std::unordered_map<Key, Entry, KeyHash> m_frames;
+    cocos2d::CCDictionary* m_indexedDict = nullptr;
+    unsigned int m_indexedCount = 0;
+    bool m_dirty = true;
+
+    void rebuild(cocos2d::CCDictionary* frames);
+
+public:
+    static SpriteFrameIndex* get();
+
+    void invalidate();
+    // Name of a cached frame with the given texture and rect, or null if there is none
+    std::string const* find(cocos2d::CCTexture2D* texture, cocos2d::CCRect const& rect);
+};
+
+// Reverse lookup of CCTextureCache, from a texture to the key it's cached under (its path).
+// Kept up to date the same way as SpriteFrameIndex.
+class TextureIndex {
+protected:
+    std::unordered_map<cocos2d::CCTexture2D*, std::string> m_keys;
+    cocos2d::CCDictionary* m_indexedDict = nullptr;
+    unsigned int m_indexedCount = 0;
+    bool m_dirty = true;
+
+    void rebuild(cocos2d::CCDictionary* textures);
+
+public:
+    static TextureIndex* get();
+
+    void invalidate();
+    // For after something may have been added to the cache, only marks the index dirty
+    // if `texture` isn't in it already
+    void added(cocos2d::CCTexture2D* texture);
+    // Key of the texture in the texture cache, or null if it isn't cached
+    std::string const* find(cocos2d::CCTexture2D* texture);
+};
@@ -6,6 +6,7 @@
 #include "fonts/RobotoMono.hpp"
 #include "fonts/SourceCodeProLight.hpp"
 #include "platform/platform.hpp"
+#include "SetterHooks.hpp"
 #include <Geode/loader/Log.hpp>
 #include <Geode/loader/Mod.hpp>
 #include "ImGui.hpp"
@@ -23,6 +24,8 @@ struct matjson::Serialize<Settings> {
         assign(value["attributes_in_tree"], s.attributesInTree);
         assign(value["always_highlight"], s.alwaysHighlight);
         assign(value["highlight_layouts"], s.highlightLayouts);
+        assign(value["show_all_bounds"], s.showAllBounds);
+        assign(value["bounds_by_class"], s.boundsByClass);
         assign(value["arrow_expand"], s.arrowExpand);
         assign(value["order_children"], s.orderChildren);
         assign(value["advanced_settings"], s.advancedSettings);
@@ -40,6 +43,7 @@ struct matjson::Serialize<Settings> {
         assign(value["tree_drag_reorder"], s.treeDragReorder);
         assign(value["show_touch_prio"], s.showTouchPrio);
         assign(value["hide_flagged_nodes"], s.hideFlaggedNodes);
+        assign(value["inspection_server"], s.inspectionServer);
 
         return Ok(s);
     }
@@ -50,6 +54,8 @@ struct matjson::Serialize<Settings> {
             { "attributes_in_tree", settings.attributesInTree },
             { "always_highlight", settings.alwaysHighlight },
             { "highlight_layouts", settings.highlightLayouts },
+            { "show_all_bounds", settings.showAllBounds },
+            { "bounds_by_class", settings.boundsByClass },
             { "arrow_expand", settings.arrowExpand },
             { "order_children", settings.orderChildren },
             { "advanced_settings", settings.advancedSettings },
@@ -67,6 +73,7 @@ struct matjson::Serialize<Settings> {
             { "tree_drag_reorder", settings.treeDragReorder },
             { "show_touch_prio", settings.showTouchPrio },
             { "hide_flagged_nodes", settings.hideFlaggedNodes },
+            { "inspection_server", settings.inspectionServer },
         });
     }
 };
@@ -105,6 +112,71 @@ CCNode* DevTools::getSelectedNode() const {
 
 void DevTools::selectNode(CCNode* node) {
     m_selectedNode = node;
+    this->clearMultiSelection();
+}
+
+void DevTools::clearMultiSelection() {
+    m_multiSelection.clear();
+    m_multiSelectionSet.clear();
+}
+
+bool DevTools::isNodeSelected(CCNode* node) const {
+    return node == m_selectedNode.data() || m_multiSelectionSet.contains(node);
+}
+
+void DevTools::toggleNodeSelected(CCNode* node) {
+    if (m_multiSelection.empty() && m_selectedNode && m_selectedNode.data() != node) {
+        m_multiSelection.push_back(m_selectedNode);
+        m_multiSelectionSet.insert(m_selectedNode);
+    }
+    if (m_multiSelectionSet.contains(node) || (m_multiSelection.empty() && node == m_selectedNode.data())) {
+        m_multiSelectionSet.erase(node);
+        std::erase_if(m_multiSelection, [&](auto const& selected) { return selected.data() == node; });
+        if (node == m_selectedNode.data()) {
+            m_selectedNode = m_multiSelection.empty() ? nullptr : m_multiSelection.back().data();
+        }
+    }
+    else {
+        m_multiSelection.push_back(node);
+        m_multiSelectionSet.insert(node);
+        m_selectedNode = node;
+    }
+    // back to a plain single selection
+    if (m_multiSelection.size() <= 1) {
+        this->clearMultiSelection();
+    }
+}
+
+void DevTools::selectTreeRange(size_t rowIndex) {
+    auto anchor = std::find_if(m_treeRows.begin(), m_treeRows.end(), [&](TreeRow const& row) {
+        return !row.page && row.node.data() == m_selectedNode.data();
+    });
+    if (anchor == m_treeRows.end()) {
+        return this->selectNode(m_treeRows[rowIndex].node);
+    }
+    auto anchorIndex = static_cast<size_t>(anchor - m_treeRows.begin());
+
+    // the anchor stays selected so the next shift-click starts from it again
+    this->clearMultiSelection();
+    for (auto i = std::min(anchorIndex, rowIndex); i <= std::max(anchorIndex, rowIndex); i++) {
+        auto& row = m_treeRows[i];
+        if (row.page || !m_multiSelectionSet.insert(row.node).second) continue;
+        m_multiSelection.push_back(row.node);
+    }
+    if (m_multiSelection.size() <= 1) {
+        this->clearMultiSelection();
+    }
+}
+
+void DevTools::selectSearchResults() {
+    if (m_searchResults.empty()) return;
+    this->selectNode(m_searchResults.front());
+    if (m_searchResults.size() == 1) return;
+    for (auto& node : m_searchResults) {
+        if (m_multiSelectionSet.insert(node).second) {
+            m_multiSelection.push_back(node);
+        }
+    }
 }
 
 void DevTools::highlightNode(CCNode* node, HighlightMode mode) {
@@ -119,8 +191,8 @@ void DevTools::setDraggedNode(CCNode* node) {
     m_draggedNode = node;
 }
 
-void DevTools::addCustomCallback(Function<void(CCNode*)>&& callback) {
-    m_customCallbacks.push_back(std::move(callback));
+void DevTools::addCustomCallback(Function<void(CCNode*)>&& callback, bool(*matches)(CCNode*)) {
+    m_customCallbacks.push_back({ std::move(callback), matches });
 }
 
 DragButton* DevTools::getDragButton() {
@@ -212,6 +284,10 @@ void DevTools::drawPages() {
         ImGui::DockBuilderDockWindow("###devtools/geometry-dash", id);
         ImGui::DockBuilderDockWindow("###devtools/advanced/mod-graph", topLeftDock);
         ImGui::DockBuilderDockWindow("###devtools/advanced/mod-index", topLeftDock);
+        ImGui::DockBuilderDockWindow("###devtools/scene-diff", bottomLeftTopHalfDock);
+        ImGui::DockBuilderDockWindow("###devtools/snapshot-viewer", bottomLeftTopHalfDock);
+        ImGui::DockBuilderDockWindow("###devtools/watch", bottomLeftTopHalfDock);
+        ImGui::DockBuilderDockWindow("###devtools/layout-profiler", bottomLeftTopHalfDock);
 
         ImGui::DockBuilderFinish(id);
     }
@@ -226,15 +302,12 @@ void DevTools::drawPages() {
         &DevTools::drawSettings
     );
 
-    // if advanced ever has more than one option, add it back
-#if 0
     if (m_settings.advancedSettings) {
         this->drawPage(
                 U8STR(FEATHER_SETTINGS " Advanced Settings###devtools/advanced/settings"),
                 &DevTools::drawAdvancedSettings
         );
     }
-#endif
 
     this->drawPage(
         U8STR(FEATHER_TOOL " Attributes###devtools/attributes"),
@@ -263,6 +336,34 @@ void DevTools::drawPages() {
         );
     }
 
+    if (m_showSceneDiff) {
+        this->drawPage(
+            U8STR(FEATHER_COLUMNS " Scene Diff###devtools/scene-diff"),
+            &DevTools::drawSceneDiff
+        );
+    }
+
+    if (m_showSnapshotViewer) {
+        this->drawPage(
+            U8STR(FEATHER_HARD_DRIVE " Snapshot Viewer###devtools/snapshot-viewer"),
+            &DevTools::drawSnapshotViewer
+        );
+    }
+
+    if (m_showWatch) {
+        this->drawPage(
+            U8STR(FEATHER_EYE " Watch###devtools/watch"),
+            &DevTools::drawWatch
+        );
+    }
+
+    if (m_showLayoutProfiler) {
+        this->drawPage(
+            U8STR(FEATHER_CLOCK " Layout Hot List###devtools/layout-profiler"),
+            &DevTools::drawLayoutProfiler
+        );
+    }
+
     if (m_settings.showTouchPrio) {
         this->drawPage(
             U8STR(FEATHER_TABLET " Touch Priority Viewer###devtools/touchprio"),
@@ -271,6 +372,15 @@ void DevTools::drawPages() {
     }
 }
 
+bool DevTools::isDevToolsWindowFocused() const {
+    auto window = ImGui::GetCurrentContext()->NavWindow;
+    if (!window) return false;
+    // the game view is docked like any other page
+    auto name = std::string_view(window->RootWindow->Name);
+    return name.find("###devtools/") != std::string_view::npos &&
+        name.find("###devtools/geometry-dash") == std::string_view::npos;
+}
+
 void DevTools::draw(GLRenderCtx* ctx) {
     if (m_visible) {
         if (m_reloadTheme) {
@@ -282,11 +392,33 @@ void DevTools::draw(GLRenderCtx* ctx) {
             0, nullptr, ImGuiDockNodeFlags_PassthruCentralNode
         );
 
+        this->sampleWatches();
+
+        // the gesture ended last frame, the next change starts a new edit
+        if (m_editGestureItem && ImGui::GetActiveID() != m_editGestureItem) {
+            m_editGestureItem = 0;
+        }
+
+        // text fields have their own undo, and the game has its own (the level editor's)
+        if (this->isDevToolsWindowFocused() && !ImGui::GetIO().WantTextInput) {
+            if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Z)) {
+                this->undoEdit();
+            }
+            else if (ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiKey_Y) || ImGui::IsKeyChordPressed(ImGuiMod_Ctrl | ImGuiMod_Shift | ImGuiKey_Z)) {
+                this->redoEdit();
+            }
+        }
+
         ImGui::PushFont(m_defaultFont);
         this->drawPages();
         if (m_selectedNode) {
             this->highlightNode(m_selectedNode, HighlightMode::Selected);
         }
+        for (auto& node : m_multiSelection) {
+            if (node.data() != m_selectedNode.data()) {
+                this->highlightNode(node, HighlightMode::Selected);
+            }
+        }
         if (this->shouldUseGDWindow()) this->drawGD(ctx);
         ImGui::PopFont();
     }
@@ -361,6 +493,7 @@ void DevTools::destroy() {
     io.BackendPlatformUserData = nullptr;
     m_fontTexture->release();
     m_fontTexture = nullptr;
+    m_renderer.destroy();
 
     ImGui::DestroyContext();
     m_setup = false;
@@ -369,6 +502,11 @@ void DevTools::destroy() {
 
 void DevTools::show(bool visible) {
     m_visible = visible;
+    SceneJournal::get()->setRecording(SceneJournalReader::Overlay, visible);
+    SetterHooks::get()->setEnabled(SetterHookUser::Attributes, visible);
+    if (!visible) {
+        this->clearTreeCaches();
+    }
 
     auto& io = ImGui::GetIO();
     io.WantCaptureMouse = visible;
@@ -385,6 +523,9 @@ bool DevTools::isVisible() {
 
 void DevTools::sceneChanged() {
     m_selectedNode = nullptr;
+    this->clearMultiSelection();
+    this->clearTreeCaches();
+    this->compactNodeState(true);
 }
 
 bool DevTools::shouldUseGDWindow() const {
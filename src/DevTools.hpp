@@ -8,8 +8,23 @@
 #include <Geode/utils/addresser.hpp>
 #include <Geode/loader/Loader.hpp>
 #include <Geode/loader/ModMetadata.hpp>
+#include <algorithm>
+#include <array>
+#include <set>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "nodes/DragButton.hpp"
+#include "NodeQuery.hpp"
+#include "SceneJournal.hpp"
+#include "LabelArena.hpp"
+#include "NodeRegistry.hpp"
+#include "SearchWorker.hpp"
+#include "SceneDiff.hpp"
+#include "BinarySnapshot.hpp"
+#include "EditJournal.hpp"
+#include "ImGuiRenderer.hpp"
 
 using namespace geode::prelude;
 
@@ -24,6 +39,8 @@ struct Settings {
     bool attributesInTree = false;
     bool alwaysHighlight = true;
     bool highlightLayouts = false;
+    bool showAllBounds = false;
+    bool boundsByClass = false;
     bool arrowExpand = false;
     bool orderChildren = true;
     bool advancedSettings = false;
@@ -44,19 +61,137 @@ struct Settings {
         float fontScale = 1.f;
     #endif
     bool hideFlaggedNodes = false;
+    bool inspectionServer = false;
 };
 
-struct TreeBranchOptions {
-    bool drag = true;
-    bool visible = true;
+static constexpr size_t NO_PARENT_ROW = static_cast<size_t>(-1);
+
+struct TreeRowOptions {
+    size_t parentRow = NO_PARENT_ROW;
+    int depth = 0;
     bool fake = false;
     bool flagHidden = false;
 };
 
-struct ParentNodeInformation {
-    bool drag = true;
-    bool visible = true;
-    bool flagHidden = false;
+// One line in the flattened node tree
+struct TreeRow {
+    Ref<CCNode> node;
+    uint64_t identity;
+    // the parent and child count the row was built with, used to notice when it goes stale
+    CCNode* parent;
+    unsigned int childCount;
+    size_t index;
+    size_t parentRow;
+    int depth;
+    bool fake;
+    bool flagHidden;
+    // rows standing in for a page of children of `node`, whose page number is `index`
+    bool page = false;
+    size_t pageStart = 0;
+    size_t pageEnd = 0;
+};
+
+// The DevTools user object and flag of a node, which are string keyed lookups otherwise
+struct NodeUserState {
+    bool hidden;
+    bool hasExtraChildren;
+};
+
+// Cached Tree label of a node along with everything that went into it
+struct TreeLabel {
+    std::string_view id;
+    std::string_view text;
+    size_t index;
+    int tag;
+    unsigned int childCount;
+    bool fake;
+    bool flagHidden;
+};
+
+// Statistics about the subtree of the selected node, walked once and then kept up to date
+// from the scene journal
+struct SubtreeStats {
+    struct Node {
+        // to tell whether the node is still alive before touching it
+        uint64_t identity;
+        CCNode* parent;
+        std::vector<CCNode*> children;
+        size_t depth;
+        std::string_view className;
+        // counting its ancestors
+        bool visible;
+        bool layout;
+    };
+
+    uint64_t root = 0;
+    size_t nodeCount = 0;
+    size_t maxDepth = 0;
+    size_t visibleCount = 0;
+    size_t invisibleCount = 0;
+    size_t layoutCount = 0;
+    // class names point into the getObjectClassName cache, sorted by count
+    std::vector<std::pair<std::string_view, size_t>> classes;
+    std::unordered_map<std::string_view, size_t> classCounts;
+    // nodes per depth, so the max depth can go down again
+    std::vector<size_t> depthCounts;
+    // every node in the subtree as last seen, journal entries are checked against these
+    std::unordered_map<CCNode*, Node> nodes;
+    uint64_t journalGeneration = 0;
+    bool dirty = true;
+};
+
+struct CustomAttributeCallback {
+    Function<void(CCNode*)> callback;
+    // checks whether the callback is for the node's type, null if the callback checks by itself
+    bool(*matches)(CCNode*) = nullptr;
+};
+
+// Which attribute drawers apply to nodes of one dynamic type
+struct AttributeDispatch {
+    bool color = false;
+    bool label = false;
+    bool axisGap = false;
+    bool texture = false;
+    bool menuItem = false;
+    // indices into m_customCallbacks, of the first callbackCount ones
+    std::vector<size_t> callbacks;
+    size_t callbackCount = 0;
+    bool computed = false;
+};
+
+enum class WatchKind : uint8_t {
+    PositionX,
+    PositionY,
+    ScaleX,
+    ScaleY,
+    Rotation,
+    Opacity,
+    Width,
+    Height,
+    // a value shown by another mod through devtools::property
+    Property,
+};
+
+// An attribute pinned to the Watch panel. The history is allocated along with the watch,
+// so taking a sample never allocates.
+struct WatchedValue {
+    static constexpr size_t HISTORY = 600;
+
+    uint64_t node;
+    WatchKind kind;
+    std::string label;
+    std::string property;
+    std::array<float, HISTORY> samples {};
+    size_t next = 0;
+    size_t count = 0;
+    bool paused = false;
+
+    void push(float value) {
+        if (paused) return;
+        samples[next] = value;
+        next = (next + 1) % HISTORY;
+        count = std::min(count + 1, HISTORY);
+    }
 };
 
 class DevTools {
@@ -75,13 +210,85 @@ protected:
     ImFont* m_monoFont     = nullptr;
     ImFont* m_boxFont      = nullptr;
     CCTexture2D* m_fontTexture = nullptr;
+    ImGuiRenderer m_renderer;
+    // hooked setters called while the Attributes page is drawn, should stay put while nothing is being edited
+    size_t m_attributeSetterCalls = 0;
+    // widget whose drag is being recorded as one edit, cleared once it's let go of
+    ImGuiID m_editGestureItem = 0;
     Ref<CCNode> m_selectedNode;
+    // everything selected when more than one node is, m_selectedNode included
+    std::vector<Ref<CCNode>> m_multiSelection;
+    std::unordered_set<CCNode*> m_multiSelectionSet;
+    std::vector<CCNode*> m_bulkParents;
+    CCPoint m_bulkOffset = CCPointZero;
+    float m_bulkScale = 1.f;
+    int m_bulkOpacity = 255;
+    int m_bulkZOrder = 0;
     Ref<CCNode> m_draggedNode;
     std::vector<std::pair<CCNode*, HighlightMode>> m_toHighlight;
-    std::vector<Function<void(CCNode*)>> m_customCallbacks;
+    std::vector<CustomAttributeCallback> m_customCallbacks;
+    std::unordered_map<std::type_index, AttributeDispatch> m_attributeDispatch;
+    // node the custom attribute callbacks are currently being called for
+    CCNode* m_attributesNode = nullptr;
+    std::vector<std::unique_ptr<WatchedValue>> m_watches;
+    int m_newWatchKind = 0;
     std::string m_searchQuery;
     std::string m_prevQuery;
-    std::unordered_map<CCNode*, bool> m_nodeOpen;
+    NodeQuery m_compiledQuery;
+    std::string m_searchError;
+    std::vector<Ref<CCNode>> m_searchResults;
+    size_t m_searchResultIndex = 0;
+    CCNode* m_scrollToNode = nullptr;
+    // per-node state is keyed by NodeRegistry identities and dropped when the node dies
+    std::unordered_map<uint64_t, bool> m_nodeOpen;
+    std::unordered_set<uint64_t> m_searchCollapsed;
+    // pages of huge child lists, as (parent identity, page) pairs
+    std::set<std::pair<uint64_t, size_t>> m_openPages;
+    std::set<std::pair<uint64_t, size_t>> m_searchCollapsedPages;
+    // whether anything in the subtree of a node matches the search query
+    std::unordered_map<CCNode*, bool> m_searchIndex;
+    bool m_searchIndexDirty = true;
+    // the search itself runs on SearchWorker, the index is swapped in once it's done
+    uint64_t m_searchRequest = 0;
+    uint64_t m_searchGeneration = 0;
+    bool m_searchPending = false;
+    std::unordered_set<CCNode*> m_snapshotSeen;
+    std::vector<TreeRow> m_treeRows;
+    // every node that has a row, plus the flag-hidden ones whose children do
+    std::unordered_set<CCNode*> m_treeRowNodes;
+    uint64_t m_journalGeneration = 0;
+    std::unordered_map<uint64_t, TreeLabel> m_treeLabels;
+    std::vector<uint64_t> m_releasedNodes;
+    // by NodeRegistry identity, dropped through the journal whenever a user object or flag is set
+    std::unordered_map<uint64_t, NodeUserState> m_nodeUserStates;
+    LabelArena m_labelArena;
+    CCNode* m_treeScene = nullptr;
+    bool m_treeDirty = true;
+    SubtreeStats m_subtreeStats;
+    std::vector<SceneCapture> m_sceneCaptures;
+    size_t m_sceneCaptureCount = 0;
+    // -1 stands for the live scene, which is captured again on every comparison
+    int m_diffBefore = 0;
+    int m_diffAfter = -1;
+    std::pair<int, int> m_diffCompared = { -1, -1 };
+    SceneCapture m_diffLive;
+    std::vector<SceneDiffEntry> m_sceneDiff;
+    std::array<size_t, 4> m_sceneDiffCounts {};
+    std::array<bool, 4> m_sceneDiffShown = { true, true, true, true };
+    std::vector<size_t> m_sceneDiffRows;
+    bool m_sceneDiffFilterDirty = false;
+    bool m_showSceneDiff = false;
+    BinarySnapshot m_binarySnapshot;
+    std::filesystem::path m_binarySnapshotPath;
+    uint32_t m_binarySnapshotSelected = binary_snapshot::NONE;
+    std::string m_binarySnapshotStatus;
+    std::vector<std::filesystem::path> m_snapshotFiles;
+    bool m_snapshotFilesDirty = true;
+    bool m_showSnapshotViewer = false;
+    bool m_showWatch = false;
+    bool m_showLayoutProfiler = false;
+    int m_layoutHotListSort = 0;
+    std::vector<uint64_t> m_layoutHotList;
     DragButton* m_dragButton = nullptr;
 
     void setupFonts();
@@ -90,12 +297,38 @@ protected:
     void drawTree();
     void drawPrioTree();
     void drawPrioHandler(CCTouchHandler* handler);
-    void drawTreeBranch(CCNode* node, size_t index, TreeBranchOptions options);
-    void drawNodeChildren(CCNode* node, ParentNodeInformation info);
+    void drawTreeRow(size_t rowIndex);
+    void drawTreePageRow(size_t rowIndex);
+    void buildTreeRows();
+    void applySceneChanges();
+    void clearTreeCaches();
+    void buildTreeBranch(CCNode* node, size_t index, TreeRowOptions options);
+    void buildNodeChildren(CCNode* node, TreeRowOptions options);
+    char const* getTreeLabel(TreeRow const& row);
+    NodeUserState const& getNodeUserState(CCNode* node);
+    CCArray* getExtraChildren(CCNode* node);
+    bool isTreeNodeOpen(uint64_t identity);
+    bool isTreePageOpen(uint64_t identity, size_t page);
+    void compactNodeState(bool shrink);
+    bool isTreeRowVisible(size_t rowIndex) const;
     void drawSettings();
     void drawAdvancedSettings();
     void drawNodeAttributes(CCNode* node);
+    AttributeDispatch const& getAttributeDispatch(CCNode* node);
+    void drawBulkAttributes();
+    void drawWatch();
+    void drawWatchMenu(CCNode* node, std::initializer_list<WatchKind> kinds);
+    void sampleWatches();
+    template <class F>
+    void applyBulkEdit(EditProperty property, F&& edit);
+    void recordEdit(CCNode* node, EditProperty property, EditValue const& before);
+    void undoEdit();
+    void redoEdit();
+    bool isDevToolsWindowFocused() const;
+    void drawEditHistory();
     void drawAttributes();
+    void drawLayoutStats(CCNode* node);
+    void drawLayoutProfiler();
     void drawBasicAttributes(CCNode* node);
     void drawColorAttributes(CCNode* node);
     void drawLabelAttributes(CCNode* node);
@@ -104,12 +337,24 @@ protected:
     void drawMenuItemAttributes(CCNode* node);
     void drawLayoutOptionsAttributes(CCNode* node);
     void drawLayoutAttributes(CCNode* node);
+    void drawStatisticsAttributes(CCNode* node);
+    void updateSubtreeStats(CCNode* node);
     void drawPreview();
     void drawNodePreview(CCNode* node);
     void drawHighlight(CCNode* node, HighlightMode mode);
     void drawLayoutHighlights(CCNode* node);
+    void drawAllBounds(CCNode* root);
     void drawGD(GLRenderCtx* ctx);
     void drawModGraph();
+    void drawSceneDiff();
+    void takeSceneSnapshot();
+    void compareSceneSnapshots();
+    void clearSceneDiff();
+    void drawSnapshotViewer();
+    void exportBinarySnapshot();
+    void drawBinarySnapshotNode(uint32_t index, uint32_t siblingIndex);
+    void drawBinarySnapshotChildren(binary_snapshot::Node const& parent, uint32_t index);
+    void drawBinarySnapshotAttributes(binary_snapshot::Node const& node);
     void drawModGraphNode(Mod* node);
     ModMetadata inputMetadata(void* treePtr, ModMetadata metadata);
     void drawPage(const char* name, void(DevTools::* fun)());
@@ -118,12 +363,13 @@ protected:
     void draw(GLRenderCtx* ctx);
 
     void newFrame();
-    void renderDrawData(ImDrawData*);
-    void renderDrawDataFallback(ImDrawData*);
 
     bool searchBranch(CCNode* node);
+    void buildSearchIndex();
+    void snapshotSearchBranch(CCNode* node, size_t parent, SceneSnapshot& snapshot);
+    void applySearchResult();
+    void selectSearchResult(size_t index);
 
-    bool hasExtension(const std::string& ext) const;
 
     DevTools() { loadSettings(); }
 
@@ -142,11 +388,23 @@ public:
 
     CCNode* getSelectedNode() const;
     void selectNode(CCNode* node);
+    // ctrl-click, adds or removes the node from the selection
+    void toggleNodeSelected(CCNode* node);
+    // shift-click, selects every tree row between the selected node and this one
+    void selectTreeRange(size_t rowIndex);
+    void selectSearchResults();
+    void addWatch(CCNode* node, WatchKind kind, std::string_view property = {});
+    // Called by devtools::property for numbers, offers to watch the value and samples it if watched
+    void watchProperty(std::string_view name, float value);
+    void clearMultiSelection();
+    bool isNodeSelected(CCNode* node) const;
+    void expandToNode(CCNode* node);
+    void invalidateTree();
     void highlightNode(CCNode* node, HighlightMode mode);
     CCNode* getDraggedNode() const;
     void setDraggedNode(CCNode* node);
 
-    void addCustomCallback(Function<void(CCNode*)>&& callback);
+    void addCustomCallback(Function<void(CCNode*)>&& callback, bool(*matches)(CCNode*) = nullptr);
 
     DragButton* getDragButton();
     void setupDragButton();
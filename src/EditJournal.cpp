@@ -0,0 +1,168 @@
+#include "EditJournal.hpp"
+#include "NodeRegistry.hpp"
+#include <Geode/utils/cocos.hpp>
+
+using namespace geode::prelude;
+
+EditJournal* EditJournal::get() {
+    static auto inst = new EditJournal();
+    return inst;
+}
+
+EditValue EditJournal::capture(CCNode* node, EditProperty property) {
+    switch (property) {
+        case EditProperty::Position: return { .x = node->getPositionX(), .y = node->getPositionY() };
+        case EditProperty::Scale: return { .x = node->getScaleX(), .y = node->getScaleY() };
+        case EditProperty::Rotation: return { .x = node->getRotationX(), .y = node->getRotationY() };
+        case EditProperty::Skew: return { .x = node->getSkewX(), .y = node->getSkewY() };
+        case EditProperty::AnchorPoint: return { .x = node->getAnchorPoint().x, .y = node->getAnchorPoint().y };
+        case EditProperty::ContentSize: return { .x = node->getContentWidth(), .y = node->getContentHeight() };
+        case EditProperty::ZOrder: return { .i = node->getZOrder() };
+        case EditProperty::Tag: return { .i = node->getTag() };
+        case EditProperty::Visible: return { .i = node->isVisible() };
+        case EditProperty::Opacity: {
+            if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+                return { .i = rgba->getOpacity() };
+            }
+            return {};
+        }
+        case EditProperty::Move: return {
+            .i = node->getZOrder(),
+            .orderOfArrival = node->m_uOrderOfArrival,
+            .parent = node->getParent() ? NodeRegistry::get()->identify(node->getParent()) : 0,
+        };
+        case EditProperty::OrderOfArrival: return { .orderOfArrival = node->m_uOrderOfArrival };
+    }
+    return {};
+}
+
+EditCommand& EditJournal::at(uint64_t position) {
+    return m_commands[position % CAPACITY];
+}
+
+void EditJournal::record(CCNode* node, EditProperty property, EditValue const& before, EditValue const& after, bool merge) {
+    auto identity = NodeRegistry::get()->identify(node);
+    auto group = m_openGroup ? m_openGroup : m_nextGroup++;
+
+    if (merge && m_cursor > m_begin && m_cursor == m_end) {
+        auto& last = this->at(m_cursor - 1);
+        if (last.node == identity && last.property == property) {
+            last.after = after;
+            return;
+        }
+    }
+
+    // anything that could have been redone is gone now
+    this->at(m_cursor) = {
+        .node = identity,
+        .group = group,
+        .property = property,
+        .before = before,
+        .after = after,
+    };
+    m_cursor += 1;
+    m_end = m_cursor;
+    if (m_end - m_begin > CAPACITY) {
+        m_begin = m_end - CAPACITY;
+    }
+}
+
+void EditJournal::beginGroup() {
+    m_openGroup = m_nextGroup++;
+}
+
+void EditJournal::endGroup() {
+    m_openGroup = 0;
+}
+
+bool EditJournal::apply(EditCommand const& command, bool undo) {
+    auto registry = NodeRegistry::get();
+    auto node = registry->find(command.node);
+    if (!node) return false;
+
+    auto const& value = undo ? command.before : command.after;
+    switch (command.property) {
+        case EditProperty::Position: node->setPosition(value.x, value.y); break;
+        case EditProperty::Scale: {
+            node->setScaleX(value.x);
+            node->setScaleY(value.y);
+        } break;
+        case EditProperty::Rotation: {
+            node->setRotationX(value.x);
+            node->setRotationY(value.y);
+        } break;
+        case EditProperty::Skew: {
+            node->setSkewX(value.x);
+            node->setSkewY(value.y);
+        } break;
+        case EditProperty::AnchorPoint: node->setAnchorPoint({ value.x, value.y }); break;
+        case EditProperty::ContentSize: {
+            node->setContentSize({ value.x, value.y });
+            node->updateLayout();
+        } break;
+        case EditProperty::ZOrder: node->setZOrder(value.i); break;
+        case EditProperty::Tag: node->setTag(value.i); break;
+        case EditProperty::Visible: node->setVisible(value.i != 0); break;
+        case EditProperty::Opacity: {
+            if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+                rgba->setOpacity(static_cast<GLubyte>(value.i));
+            }
+        } break;
+        case EditProperty::Move: {
+            auto parent = registry->find(value.parent);
+            if (!parent) return false;
+            Ref<CCNode> keepAlive = node;
+            auto oldParent = node->getParent();
+            node->removeFromParentAndCleanup(false);
+            parent->addChild(node, value.i);
+            node->m_uOrderOfArrival = value.orderOfArrival;
+            if (oldParent && oldParent != parent) oldParent->updateLayout();
+            parent->updateLayout();
+        } break;
+        case EditProperty::OrderOfArrival: {
+            node->m_uOrderOfArrival = value.orderOfArrival;
+            if (auto parent = node->getParent()) {
+                parent->m_bReorderChildDirty = true;
+            }
+        } break;
+    }
+    return true;
+}
+
+bool EditJournal::canUndo() const {
+    return m_cursor > m_begin;
+}
+
+bool EditJournal::canRedo() const {
+    return m_cursor < m_end;
+}
+
+void EditJournal::undo() {
+    if (!this->canUndo()) return;
+    auto group = this->at(m_cursor - 1).group;
+    while (m_cursor > m_begin && this->at(m_cursor - 1).group == group) {
+        m_cursor -= 1;
+        this->apply(this->at(m_cursor), true);
+    }
+}
+
+void EditJournal::redo() {
+    if (!this->canRedo()) return;
+    auto group = this->at(m_cursor).group;
+    while (m_cursor < m_end && this->at(m_cursor).group == group) {
+        this->apply(this->at(m_cursor), false);
+        m_cursor += 1;
+    }
+}
+
+void EditJournal::clear() {
+    m_begin = m_cursor = m_end = 0;
+}
+
+size_t EditJournal::undoCount() const {
+    return m_cursor - m_begin;
+}
+
+size_t EditJournal::redoCount() const {
+    return m_end - m_cursor;
+}
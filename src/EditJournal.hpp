@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cocos2d.h>
+
+enum class EditProperty : uint8_t {
+    Position,
+    Scale,
+    Rotation,
+    Skew,
+    AnchorPoint,
+    ContentSize,
+    ZOrder,
+    Tag,
+    Visible,
+    Opacity,
+    // moved to another parent or place among its siblings by dragging it in the tree
+    Move,
+    // siblings shifted to make room for a node dropped in between them
+    OrderOfArrival,
+};
+
+// Everything any property needs, so commands can be stored inline
+struct EditValue {
+    float x = 0.f;
+    float y = 0.f;
+    int i = 0;
+    // only for Move and OrderOfArrival
+    unsigned int orderOfArrival = 0;
+    uint64_t parent = 0;
+};
+
+struct EditCommand {
+    uint64_t node;
+    // commands with the same group are undone and redone together
+    uint32_t group;
+    EditProperty property;
+    EditValue before;
+    EditValue after;
+};
+
+// Undo history of the edits made through DevTools, kept in a fixed ring buffer so recording
+// never allocates and the oldest edits are simply forgotten once it's full.
+// Nodes are referred to by their NodeRegistry identity, edits of destroyed nodes are skipped.
+class EditJournal {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+protected:
+    std::array<EditCommand, CAPACITY> m_commands;
+    // absolute positions, the oldest kept command is at m_begin
+    uint64_t m_begin = 0;
+    uint64_t m_cursor = 0;
+    uint64_t m_end = 0;
+    uint32_t m_nextGroup = 1;
+    uint32_t m_openGroup = 0;
+
+    EditCommand& at(uint64_t position);
+    bool apply(EditCommand const& command, bool undo);
+
+public:
+    static EditJournal* get();
+
+    // Current value of the property, to record before and after editing it
+    static EditValue capture(cocos2d::CCNode* node, EditProperty property);
+
+    // `merge` folds the edit into the previous one if it's for the same node and property,
+    // for widgets that report a change every frame while being dragged
+    void record(cocos2d::CCNode* node, EditProperty property, EditValue const& before, EditValue const& after, bool merge = false);
+
+    // Edits recorded between these are undone in one go
+    void beginGroup();
+    void endGroup();
+
+    bool canUndo() const;
+    bool canRedo() const;
+    void undo();
+    void redo();
+    void clear();
+
+    size_t undoCount() const;
+    size_t redoCount() const;
+};
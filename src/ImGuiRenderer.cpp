@@ -0,0 +1,244 @@
+#include "ImGuiRenderer.hpp"
+#include <algorithm>
+#include <cstring>
+#if defined(GEODE_IS_MACOS)
+#include <OpenGL/gl.h>
+#elif defined(GEODE_IS_IOS)
+#include <OpenGLES/ES2/gl.h>
+#endif
+
+using namespace cocos2d;
+
+// based off https://github.com/matcool/gd-imgui-cocos
+
+namespace {
+    // same as toCocos, from the draw data's own size so it doesn't need the ImGui context
+    struct ToCocos {
+        ImVec2 displaySize;
+        CCSize winSize;
+
+        CCPoint operator()(ImVec2 const& pos) const {
+            return CCPoint(
+                pos.x / displaySize.x * winSize.width,
+                (1.f - pos.y / displaySize.y) * winSize.height
+            );
+        }
+    };
+
+    void drawTriangle(const std::array<CCPoint, 3>& poli, const std::array<ccColor4F, 3>& colors, const std::array<CCPoint, 3>& uvs) {
+        auto* shader = CCShaderCache::sharedShaderCache()->programForKey(kCCShader_PositionTextureColor);
+        shader->use();
+        shader->setUniformsForBuiltins();
+
+        ccGLEnableVertexAttribs(kCCVertexAttribFlag_PosColorTex);
+
+        static_assert(sizeof(CCPoint) == sizeof(ccVertex2F), "so the cocos devs were right then");
+
+        glVertexAttribPointer(kCCVertexAttrib_Position, 2, GL_FLOAT, GL_FALSE, 0, poli.data());
+        glVertexAttribPointer(kCCVertexAttrib_Color, 4, GL_FLOAT, GL_FALSE, 0, colors.data());
+        glVertexAttribPointer(kCCVertexAttrib_TexCoords, 2, GL_FLOAT, GL_FALSE, 0, uvs.data());
+
+        glDrawArrays(GL_TRIANGLE_FAN, 0, 3);
+    }
+}
+
+bool ImGuiRenderer::hasExtension(std::string_view ext) {
+    auto exts = reinterpret_cast<const char*>(glGetString(GL_EXTENSIONS));
+    if (exts == nullptr) {
+        return false;
+    }
+    return std::string_view(exts).find(ext) != std::string_view::npos;
+}
+
+RenderStats const& ImGuiRenderer::lastStats() const {
+    return m_lastStats;
+}
+
+void ImGuiRenderer::destroy() {
+    if (m_vao) {
+        glDeleteVertexArrays(1, &m_vao);
+        glDeleteBuffers(2, m_vbos.data());
+    }
+    m_vao = 0;
+    m_vbos = {};
+    m_vboCapacity = {};
+    // the next context might not have the same extensions
+    m_hasVaos.reset();
+}
+
+void ImGuiRenderer::renderDrawDataFallback(ImDrawData* draw_data) {
+    m_stats = {};
+    glEnable(GL_SCISSOR_TEST);
+
+    ToCocos toCocos { draw_data->DisplaySize, CCDirector::sharedDirector()->getWinSize() };
+
+    for (int i = 0; i < draw_data->CmdListsCount; ++i) {
+        auto* list = draw_data->CmdLists[i];
+        auto* idxBuffer = list->IdxBuffer.Data;
+        auto* vtxBuffer = list->VtxBuffer.Data;
+        m_stats.vertices += list->VtxBuffer.Size;
+        m_stats.indices += list->IdxBuffer.Size;
+        for (auto& cmd : list->CmdBuffer) {
+            ccGLBindTexture2D(static_cast<GLuint>(cmd.GetTexID()));
+            m_stats.textureBinds += 1;
+
+            const auto rect = cmd.ClipRect;
+            const auto orig = toCocos(ImVec2(rect.x, rect.y));
+            const auto end = toCocos(ImVec2(rect.z, rect.w));
+            if (end.x <= orig.x || end.y >= orig.y)
+                continue;
+            CCDirector::sharedDirector()->getOpenGLView()->setScissorInPoints(orig.x, end.y, end.x - orig.x, orig.y - end.y);
+            m_stats.scissorChanges += 1;
+
+            for (unsigned int i = 0; i < cmd.ElemCount; i += 3) {
+                const auto a = vtxBuffer[idxBuffer[cmd.IdxOffset + i + 0]];
+                const auto b = vtxBuffer[idxBuffer[cmd.IdxOffset + i + 1]];
+                const auto c = vtxBuffer[idxBuffer[cmd.IdxOffset + i + 2]];
+                std::array<CCPoint, 3> points = {
+                    toCocos(a.pos),
+                    toCocos(b.pos),
+                    toCocos(c.pos),
+                };
+                static constexpr auto ccc4FromImColor = [](const ImColor color) {
+                    // beautiful
+                    return ccc4f(color.Value.x, color.Value.y, color.Value.z, color.Value.w);
+                };
+                std::array<ccColor4F, 3> colors = {
+                    ccc4FromImColor(a.col),
+                    ccc4FromImColor(b.col),
+                    ccc4FromImColor(c.col),
+                };
+
+                std::array<CCPoint, 3> uvs = {
+                    ccp(a.uv.x, a.uv.y),
+                    ccp(b.uv.x, b.uv.y),
+                    ccp(c.uv.x, c.uv.y),
+                };
+
+                drawTriangle(points, colors, uvs);
+                m_stats.drawCalls += 1;
+                m_stats.bytesUploaded += sizeof(points) + sizeof(colors) + sizeof(uvs);
+            }
+        }
+    }
+
+    glDisable(GL_SCISSOR_TEST);
+    m_lastStats = m_stats;
+}
+
+void ImGuiRenderer::prepareBuffer(size_t index, GLenum target, size_t size) {
+    // the whole frame goes in at increasing offsets after this, and the previous frame
+    // may still be drawing from the old storage, so it always gets fresh storage
+    // instead of making the driver wait (orphaning)
+    if (size > m_vboCapacity[index]) {
+        m_vboCapacity[index] = std::max(size, m_vboCapacity[index] * 2);
+        m_stats.bufferAllocations += 1;
+    }
+    else {
+        m_stats.bufferOrphans += 1;
+    }
+    glBufferData(target, m_vboCapacity[index], nullptr, GL_STREAM_DRAW);
+}
+
+void ImGuiRenderer::renderDrawData(ImDrawData* draw_data) {
+    if (!m_hasVaos) {
+        m_hasVaos = hasExtension("GL_ARB_vertex_array_object");
+    }
+    if (!*m_hasVaos) {
+        return this->renderDrawDataFallback(draw_data);
+    }
+
+    m_stats = {};
+    glEnable(GL_SCISSOR_TEST);
+
+    if (!m_vao) {
+        glGenVertexArrays(1, &m_vao);
+        glBindVertexArray(m_vao);
+
+        glGenBuffers(2, m_vbos.data());
+        m_vboCapacity = {};
+
+        // the element buffer binding is part of the vao, the array buffer one isn't
+        glBindBuffer(GL_ARRAY_BUFFER, m_vbos[0]);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_vbos[1]);
+
+        glEnableVertexAttribArray(kCCVertexAttrib_Position);
+        glEnableVertexAttribArray(kCCVertexAttrib_TexCoords);
+        glEnableVertexAttribArray(kCCVertexAttrib_Color);
+    }
+    else {
+        glBindVertexArray(m_vao);
+        glBindBuffer(GL_ARRAY_BUFFER, m_vbos[0]);
+    }
+
+    ToCocos toCocos { draw_data->DisplaySize, CCDirector::sharedDirector()->getWinSize() };
+
+    size_t vtxSize = 0;
+    size_t idxSize = 0;
+    for (int i = 0; i < draw_data->CmdListsCount; ++i) {
+        auto* list = draw_data->CmdLists[i];
+        vtxSize += list->VtxBuffer.Size * sizeof(ImDrawVert);
+        idxSize += list->IdxBuffer.Size * sizeof(ImDrawIdx);
+    }
+    this->prepareBuffer(0, GL_ARRAY_BUFFER, vtxSize);
+    this->prepareBuffer(1, GL_ELEMENT_ARRAY_BUFFER, idxSize);
+
+    auto* shader = CCShaderCache::sharedShaderCache()->programForKey(kCCShader_PositionTextureColor);
+    shader->use();
+    shader->setUniformsForBuiltins();
+
+    ImTextureID boundTexture = ImTextureID_Invalid;
+    size_t vtxOffset = 0;
+    size_t idxOffset = 0;
+    for (int i = 0; i < draw_data->CmdListsCount; ++i) {
+        auto* list = draw_data->CmdLists[i];
+
+        // convert vertex coords to cocos space
+        for(int j = 0; j < list->VtxBuffer.size(); j++) {
+            auto point = toCocos(list->VtxBuffer[j].pos);
+            list->VtxBuffer[j].pos = ImVec2(point.x, point.y);
+        }
+
+        auto vtxBytes = list->VtxBuffer.Size * sizeof(ImDrawVert);
+        auto idxBytes = list->IdxBuffer.Size * sizeof(ImDrawIdx);
+        glBufferSubData(GL_ARRAY_BUFFER, vtxOffset, vtxBytes, list->VtxBuffer.Data);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, idxOffset, idxBytes, list->IdxBuffer.Data);
+        m_stats.bytesUploaded += vtxBytes + idxBytes;
+        m_stats.vertices += list->VtxBuffer.Size;
+        m_stats.indices += list->IdxBuffer.Size;
+
+        // indices are relative to the list, so the attributes start where its vertices do
+        auto vtxBase = reinterpret_cast<char const*>(vtxOffset);
+        glVertexAttribPointer(kCCVertexAttrib_Position, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), vtxBase + offsetof(ImDrawVert, pos));
+        glVertexAttribPointer(kCCVertexAttrib_TexCoords, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), vtxBase + offsetof(ImDrawVert, uv));
+        glVertexAttribPointer(kCCVertexAttrib_Color, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), vtxBase + offsetof(ImDrawVert, col));
+
+        for (auto& cmd : list->CmdBuffer) {
+            const auto rect = cmd.ClipRect;
+            const auto orig = toCocos(ImVec2(rect.x, rect.y));
+            const auto end = toCocos(ImVec2(rect.z, rect.w));
+            if (end.x <= orig.x || end.y >= orig.y)
+                continue;
+
+            if (cmd.GetTexID() != boundTexture) {
+                boundTexture = cmd.GetTexID();
+                ccGLBindTexture2D(static_cast<GLuint>(boundTexture));
+                m_stats.textureBinds += 1;
+            }
+            CCDirector::sharedDirector()->getOpenGLView()->setScissorInPoints(orig.x, end.y, end.x - orig.x, orig.y - end.y);
+            m_stats.scissorChanges += 1;
+
+            glDrawElements(GL_TRIANGLES, cmd.ElemCount, GL_UNSIGNED_SHORT, reinterpret_cast<GLvoid const*>(idxOffset + cmd.IdxOffset * sizeof(ImDrawIdx)));
+            m_stats.drawCalls += 1;
+        }
+
+        vtxOffset += vtxBytes;
+        idxOffset += idxBytes;
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDisable(GL_SCISSOR_TEST);
+    m_lastStats = m_stats;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <imgui.h>
+#include <cocos2d.h>
+
+// What the backend did to draw the last frame, for keeping an eye on its cost
+struct RenderStats {
+    size_t drawCalls = 0;
+    size_t textureBinds = 0;
+    size_t scissorChanges = 0;
+    // buffers growing, should stop once the UI stops growing
+    size_t bufferAllocations = 0;
+    // storage handed back to the driver at the start of a frame, one per buffer
+    size_t bufferOrphans = 0;
+    size_t bytesUploaded = 0;
+    size_t vertices = 0;
+    size_t indices = 0;
+};
+
+// Draws ImGui's draw data with cocos' shaders. Only needs cocos for GL and the
+// shader cache, so it can be run against a recording GL outside the game.
+class ImGuiRenderer {
+protected:
+    // kept across frames, the buffers only ever grow
+    GLuint m_vao = 0;
+    std::array<GLuint, 2> m_vbos = {};
+    std::array<size_t, 2> m_vboCapacity = {};
+    std::optional<bool> m_hasVaos;
+    RenderStats m_stats;
+    RenderStats m_lastStats;
+
+    void prepareBuffer(size_t index, GLenum target, size_t size);
+
+public:
+    void renderDrawData(ImDrawData* drawData);
+    void renderDrawDataFallback(ImDrawData* drawData);
+    // Deletes the GL objects, for when the GL context is about to go away
+    void destroy();
+
+    RenderStats const& lastStats() const;
+    static bool hasExtension(std::string_view ext);
+};
@@ -0,0 +1,696 @@
+#include "InspectionServer.hpp"
+#include "JsonExport.hpp"
+#include "NodeRegistry.hpp"
+#include "SceneJournal.hpp"
+#include "SetterHooks.hpp"
+#include "platform/utils.hpp"
+#include <Geode/modify/CCScheduler.hpp>
+#include <Geode/ui/OverlayManager.hpp>
+#include <Geode/utils/cocos.hpp>
+#include <Geode/utils/file.hpp>
+#include <algorithm>
+#include <fmt/ranges.h>
+#include <random>
+#include <utility>
+
+#ifdef GEODE_IS_WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+using namespace geode::prelude;
+
+namespace {
+    // a client that stops reading gets dropped rather than buffered forever
+    constexpr size_t MAX_PENDING_OUTPUT = 64 * 1024 * 1024;
+    constexpr size_t MAX_LINE_LENGTH = 1024 * 1024;
+
+#ifdef GEODE_IS_WINDOWS
+    bool wouldBlock() {
+        return WSAGetLastError() == WSAEWOULDBLOCK;
+    }
+
+    void closeSocket(intptr_t socket) {
+        closesocket(static_cast<SOCKET>(socket));
+    }
+
+    bool setNonBlocking(intptr_t socket) {
+        u_long mode = 1;
+        return ioctlsocket(static_cast<SOCKET>(socket), FIONBIO, &mode) == 0;
+    }
+
+    constexpr int SEND_FLAGS = 0;
+#else
+    bool wouldBlock() {
+        return errno == EAGAIN || errno == EWOULDBLOCK;
+    }
+
+    void closeSocket(intptr_t socket) {
+        ::close(static_cast<int>(socket));
+    }
+
+    bool setNonBlocking(intptr_t socket) {
+        auto flags = fcntl(static_cast<int>(socket), F_GETFL, 0);
+        return flags >= 0 && fcntl(static_cast<int>(socket), F_SETFL, flags | O_NONBLOCK) == 0;
+    }
+
+    #ifdef MSG_NOSIGNAL
+        constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+    #else
+        constexpr int SEND_FLAGS = 0;
+    #endif
+#endif
+
+    class TcpConnection final : public InspectionConnection {
+    private:
+        intptr_t m_socket;
+        std::string m_input;
+        std::string m_output;
+        bool m_open = true;
+
+        void flush() {
+            while (m_open && !m_output.empty()) {
+                auto sent = ::send(m_socket, m_output.data(), static_cast<int>(std::min<size_t>(m_output.size(), 1 << 20)), SEND_FLAGS);
+                if (sent <= 0) {
+                    if (sent < 0 && wouldBlock()) break;
+                    this->close();
+                    return;
+                }
+                m_output.erase(0, static_cast<size_t>(sent));
+            }
+            if (m_output.size() > MAX_PENDING_OUTPUT) {
+                this->close();
+            }
+        }
+
+    public:
+        TcpConnection(intptr_t socket) : m_socket(socket) {}
+
+        ~TcpConnection() override {
+            this->close();
+        }
+
+        void close() override {
+            if (m_open) {
+                closeSocket(m_socket);
+                m_open = false;
+            }
+        }
+
+        bool receive(std::string& line) override {
+            this->flush();
+            char buffer[4096];
+            while (m_open) {
+                auto received = ::recv(m_socket, buffer, sizeof(buffer), 0);
+                if (received <= 0) {
+                    if (received < 0 && wouldBlock()) break;
+                    this->close();
+                    break;
+                }
+                m_input.append(buffer, static_cast<size_t>(received));
+                if (m_input.size() > MAX_LINE_LENGTH) {
+                    this->close();
+                    return false;
+                }
+            }
+
+            auto end = m_input.find('\n');
+            if (end == std::string::npos) return false;
+            line.assign(m_input, 0, end);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            m_input.erase(0, end + 1);
+            return true;
+        }
+
+        void send(std::string_view data) override {
+            if (!m_open) return;
+            m_output.append(data);
+            this->flush();
+        }
+
+        bool isOpen() const override {
+            return m_open;
+        }
+    };
+
+    // what a browser sends first, a page posting to the server must not get to do anything
+    bool isHttpRequest(std::string_view line) {
+        for (auto method : { "GET ", "POST ", "PUT ", "DELETE ", "HEAD ", "OPTIONS ", "PATCH ", "CONNECT ", "TRACE " }) {
+            if (line.starts_with(method)) return true;
+        }
+        return false;
+    }
+
+    // doesn't stop at the first difference, so the time taken says nothing about the token
+    bool tokensEqual(std::string_view a, std::string_view b) {
+        if (a.size() != b.size()) return false;
+        unsigned char diff = 0;
+        for (size_t i = 0; i < a.size(); i++) {
+            diff |= static_cast<unsigned char>(a[i] ^ b[i]);
+        }
+        return diff == 0;
+    }
+}
+
+void LoopbackConnection::push(std::string line) {
+    m_incoming.push_back(std::move(line));
+}
+
+std::string LoopbackConnection::take() {
+    return std::exchange(m_outgoing, {});
+}
+
+bool LoopbackConnection::receive(std::string& line) {
+    if (m_incoming.empty()) return false;
+    line = std::move(m_incoming.front());
+    m_incoming.pop_front();
+    return true;
+}
+
+void LoopbackConnection::send(std::string_view data) {
+    if (m_open) m_outgoing.append(data);
+}
+
+bool LoopbackConnection::isOpen() const {
+    return m_open;
+}
+
+void LoopbackConnection::close() {
+    m_open = false;
+}
+
+InspectionServer* InspectionServer::get() {
+    static auto inst = new InspectionServer();
+    return inst;
+}
+
+bool InspectionServer::isEnabled() const {
+    return m_enabled;
+}
+
+void InspectionServer::setEnabled(bool enabled) {
+    if (m_enabled == enabled) return;
+    m_enabled = enabled;
+    if (enabled) {
+        if (!this->listen()) {
+            log::error("Unable to start the inspection server on port {}", PORT);
+        }
+    }
+    else {
+        this->closeListener();
+        m_clients.clear();
+    }
+}
+
+std::filesystem::path InspectionServer::getTokenPath() {
+    return Mod::get()->getSaveDir() / "inspection-token";
+}
+
+bool InspectionServer::writeToken() {
+    // one per game session, so a token read by a client stays good until the game restarts
+    if (m_token.empty()) {
+        std::random_device random;
+        for (int i = 0; i < 4; i++) {
+            fmt::format_to(std::back_inserter(m_token), "{:08x}", random());
+        }
+    }
+    auto res = utils::file::writeString(getTokenPath(), m_token);
+    if (!res) {
+        log::error("Unable to write the inspection server token: {}", res.unwrapErr());
+        return false;
+    }
+    return true;
+}
+
+bool InspectionServer::listen() {
+    // nobody could connect without it
+    if (!this->writeToken()) return false;
+
+#ifdef GEODE_IS_WINDOWS
+    static bool startedUp = [] {
+        WSADATA data;
+        return WSAStartup(MAKEWORD(2, 2), &data) == 0;
+    }();
+    if (!startedUp) return false;
+#endif
+
+    auto handle = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    auto socket = static_cast<intptr_t>(handle);
+#ifdef GEODE_IS_WINDOWS
+    if (handle == INVALID_SOCKET) return false;
+#else
+    if (handle < 0) return false;
+#endif
+
+    int reuse = 1;
+    setsockopt(handle, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<char const*>(&reuse), sizeof(reuse));
+
+    // never reachable from outside the machine
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(PORT);
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (
+        ::bind(handle, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(handle, 4) != 0 ||
+        !setNonBlocking(socket)
+    ) {
+        closeSocket(socket);
+        return false;
+    }
+    m_listenSocket = socket;
+    log::info("Inspection server listening on 127.0.0.1:{}", PORT);
+    return true;
+}
+
+void InspectionServer::closeListener() {
+    if (m_listenSocket != -1) {
+        closeSocket(m_listenSocket);
+        m_listenSocket = -1;
+    }
+}
+
+void InspectionServer::acceptClients() {
+    if (m_listenSocket == -1) return;
+    while (true) {
+        auto handle = ::accept(m_listenSocket, nullptr, nullptr);
+#ifdef GEODE_IS_WINDOWS
+        if (handle == INVALID_SOCKET) return;
+#else
+        if (handle < 0) return;
+#endif
+        auto socket = static_cast<intptr_t>(handle);
+        if (!setNonBlocking(socket)) {
+            closeSocket(socket);
+            continue;
+        }
+#if defined(SO_NOSIGPIPE)
+        int noSigPipe = 1;
+        setsockopt(handle, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+        this->addConnection(std::make_unique<TcpConnection>(socket));
+    }
+}
+
+void InspectionServer::addConnection(std::unique_ptr<InspectionConnection> connection) {
+    m_clients.push_back({ .connection = std::move(connection) });
+}
+
+size_t InspectionServer::getClientCount() const {
+    return m_clients.size();
+}
+
+void InspectionServer::propertiesChanged(CCNode* node) {
+    m_changedProperties.insert(node);
+}
+
+CCNode* InspectionServer::findNode(uint64_t identity) const {
+    // the mirror only ever holds nodes the registry knows, a dead one can't be found
+    auto it = m_mirror.find(identity);
+    if (it == m_mirror.end()) return nullptr;
+    auto node = NodeRegistry::get()->find(identity);
+    return node == it->second.node ? node : nullptr;
+}
+
+void InspectionServer::appendMirrorNode(std::string& out, CCNode* node, uint64_t identity, uint64_t parent) {
+    fmt::format_to(std::back_inserter(out), "{{\"node\":{},\"parent\":{},\"class\":", identity, parent);
+    appendJsonString(out, getObjectClassName(node));
+    out += ",\"id\":";
+    appendJsonString(out, node->getID());
+    fmt::format_to(std::back_inserter(out), ",\"tag\":{},\"visible\":{}}},", node->getTag(), node->isVisible());
+}
+
+void InspectionServer::mirrorBranch(CCNode* node, uint64_t parent, std::vector<uint64_t>& siblings, std::string* out) {
+    if (!node) return;
+    auto identity = NodeRegistry::get()->identify(node);
+    siblings.push_back(identity);
+    m_mirrorByPointer[node] = identity;
+
+    auto& entry = m_mirror[identity];
+    entry.node = node;
+    entry.parent = parent;
+    entry.children.clear();
+    if (out) {
+        this->appendMirrorNode(*out, node, identity, parent);
+    }
+    for (auto child : CCArrayExt<CCNode*>(node->getChildren())) {
+        this->mirrorBranch(child, identity, entry.children, out);
+    }
+}
+
+void InspectionServer::forgetBranch(uint64_t identity) {
+    auto it = m_mirror.find(identity);
+    if (it == m_mirror.end()) return;
+    for (auto child : it->second.children) {
+        // a child that moved elsewhere in the meantime belongs to its new parent now
+        auto childIt = m_mirror.find(child);
+        if (childIt != m_mirror.end() && childIt->second.parent == identity) {
+            this->forgetBranch(child);
+        }
+    }
+    auto pointerIt = m_mirrorByPointer.find(it->second.node);
+    if (pointerIt != m_mirrorByPointer.end() && pointerIt->second == identity) {
+        m_mirrorByPointer.erase(pointerIt);
+    }
+    m_mirror.erase(it);
+}
+
+void InspectionServer::rebuildMirror() {
+    m_mirror.clear();
+    m_mirrorByPointer.clear();
+    m_roots.clear();
+    m_mirrorScene = CCDirector::get()->getRunningScene();
+    this->mirrorBranch(m_mirrorScene, 0, m_roots, nullptr);
+    this->mirrorBranch(OverlayManager::get(), 0, m_roots, nullptr);
+    m_mirrorValid = true;
+}
+
+void InspectionServer::beginChange() {
+    if (m_deltaEmpty) {
+        m_delta = "{\"type\":\"delta\",\"changes\":[";
+        m_deltaEmpty = false;
+    }
+    else {
+        m_delta += ',';
+    }
+}
+
+void InspectionServer::reconcileChildren(uint64_t identity) {
+    auto& entry = m_mirror[identity];
+    auto registry = NodeRegistry::get();
+
+    std::vector<uint64_t> current;
+    current.reserve(entry.node->getChildrenCount());
+    for (auto child : CCArrayExt<CCNode*>(entry.node->getChildren())) {
+        current.push_back(registry->identify(child));
+    }
+    if (current == entry.children) return;
+
+    std::unordered_set<uint64_t> currentSet(current.begin(), current.end());
+    std::unordered_set<uint64_t> previousSet(entry.children.begin(), entry.children.end());
+
+    // what the client's list looks like after the removals and additions below
+    std::vector<uint64_t> expected;
+    for (auto child : entry.children) {
+        if (currentSet.contains(child)) {
+            expected.push_back(child);
+            continue;
+        }
+        auto it = m_mirror.find(child);
+        if (it != m_mirror.end() && it->second.parent == identity) {
+            this->beginChange();
+            fmt::format_to(std::back_inserter(m_delta), "{{\"op\":\"remove\",\"node\":{}}}", child);
+            this->forgetBranch(child);
+        }
+    }
+
+    for (size_t i = 0; i < current.size(); i++) {
+        auto child = current[i];
+        if (previousSet.contains(child)) continue;
+
+        // moved over from a parent that hasn't been looked at yet
+        if (auto it = m_mirror.find(child); it != m_mirror.end()) {
+            if (auto oldParent = m_mirror.find(it->second.parent); oldParent != m_mirror.end()) {
+                std::erase(oldParent->second.children, child);
+            }
+            this->beginChange();
+            fmt::format_to(std::back_inserter(m_delta), "{{\"op\":\"remove\",\"node\":{}}}", child);
+            this->forgetBranch(child);
+        }
+
+        this->beginChange();
+        fmt::format_to(std::back_inserter(m_delta), "{{\"op\":\"add\",\"parent\":{},\"index\":{},\"nodes\":[", identity, i);
+        std::vector<uint64_t> added;
+        this->mirrorBranch(static_cast<CCNode*>(entry.node->getChildren()->objectAtIndex(i)), identity, added, &m_delta);
+        if (m_delta.back() == ',') m_delta.pop_back();
+        m_delta += "]}";
+        expected.insert(expected.begin() + std::min(i, expected.size()), child);
+    }
+
+    if (expected != current) {
+        this->beginChange();
+        fmt::format_to(std::back_inserter(m_delta), "{{\"op\":\"order\",\"node\":{},\"children\":[{}]}}", identity, fmt::join(current, ","));
+    }
+    entry.children = std::move(current);
+}
+
+void InspectionServer::sendTree(Client& client) {
+    std::string out;
+    fmt::format_to(std::back_inserter(out), "{{\"type\":\"tree\",\"roots\":[{}],\"nodes\":[", fmt::join(m_roots, ","));
+
+    std::vector<uint64_t> stack(m_roots.rbegin(), m_roots.rend());
+    while (!stack.empty()) {
+        auto identity = stack.back();
+        stack.pop_back();
+        auto it = m_mirror.find(identity);
+        if (it == m_mirror.end()) continue;
+        this->appendMirrorNode(out, it->second.node, identity, it->second.parent);
+        stack.insert(stack.end(), it->second.children.rbegin(), it->second.children.rend());
+    }
+    if (out.back() == ',') out.pop_back();
+    out += "]}\n";
+    client.connection->send(out);
+    client.synced = true;
+}
+
+void InspectionServer::setProperty(Client& client, CCNode* node, uint64_t identity, std::string const& property, matjson::Value const& value) {
+    auto number = [&](matjson::Value const& v) { return static_cast<float>(v.asDouble().unwrapOr(0.0)); };
+
+    if (property == "position") {
+        node->setPosition(number(value[0]), number(value[1]));
+    }
+    else if (property == "scale") {
+        node->setScaleX(number(value[0]));
+        node->setScaleY(number(value[1]));
+    }
+    else if (property == "rotation") {
+        node->setRotation(number(value));
+    }
+    else if (property == "skew") {
+        node->setSkewX(number(value[0]));
+        node->setSkewY(number(value[1]));
+    }
+    else if (property == "anchor_point") {
+        node->setAnchorPoint({ number(value[0]), number(value[1]) });
+    }
+    else if (property == "content_size") {
+        node->setContentSize({ number(value[0]), number(value[1]) });
+        node->updateLayout();
+    }
+    else if (property == "visible") {
+        node->setVisible(value.asBool().unwrapOr(node->isVisible()));
+    }
+    else if (property == "z_order") {
+        node->setZOrder(static_cast<int>(value.asInt().unwrapOr(node->getZOrder())));
+    }
+    else if (property == "tag") {
+        node->setTag(static_cast<int>(value.asInt().unwrapOr(node->getTag())));
+    }
+    else if (property == "id") {
+        node->setID(value.asString().unwrapOr(node->getID()));
+    }
+    else if (property == "opacity") {
+        if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+            rgba->setOpacity(static_cast<GLubyte>(std::clamp<intmax_t>(value.asInt().unwrapOr(255), 0, 255)));
+        }
+    }
+    else {
+        client.connection->send(fmt::format("{{\"type\":\"error\",\"message\":\"Unknown property\",\"node\":{}}}\n", identity));
+        return;
+    }
+    // not every setter is hooked, make sure the change goes out
+    m_changedProperties.insert(node);
+    client.connection->send(fmt::format("{{\"type\":\"set\",\"node\":{},\"ok\":true}}\n", identity));
+}
+
+void InspectionServer::authenticate(Client& client, std::string_view line) {
+    if (isHttpRequest(line)) {
+        client.connection->close();
+        return;
+    }
+    auto parsed = matjson::parse(line);
+    if (
+        !parsed || parsed.unwrap()["type"].asString().unwrapOr("") != "hello" ||
+        !tokensEqual(parsed.unwrap()["token"].asString().unwrapOr(""), m_token)
+    ) {
+        client.connection->send("{\"type\":\"error\",\"message\":\"Expected a hello with the token\"}\n");
+        client.connection->close();
+        return;
+    }
+    client.authenticated = true;
+    client.connection->send("{\"type\":\"hello\",\"ok\":true}\n");
+}
+
+void InspectionServer::handleRequest(Client& client, std::string_view line) {
+    if (!client.authenticated) {
+        return this->authenticate(client, line);
+    }
+    auto parsed = matjson::parse(line);
+    if (!parsed) {
+        client.connection->send("{\"type\":\"error\",\"message\":\"Invalid JSON\"}\n");
+        return;
+    }
+    auto const json = std::move(parsed).unwrap();
+    auto type = json["type"].asString().unwrapOr("");
+
+    if (type == "sync") {
+        // sent once the frame's changes are in the mirror
+        client.synced = false;
+        m_pendingSyncs = true;
+        return;
+    }
+
+    auto identity = static_cast<uint64_t>(json["node"].asInt().unwrapOr(0));
+    auto node = this->findNode(identity);
+    if (!node) {
+        client.connection->send(fmt::format("{{\"type\":\"error\",\"message\":\"Unknown node\",\"node\":{}}}\n", identity));
+        return;
+    }
+
+    if (type == "attributes") {
+        std::string out;
+        fmt::format_to(std::back_inserter(out), "{{\"type\":\"attributes\",\"node\":{},\"attributes\":{{", identity);
+        appendNodeAttributes(out, node);
+        out += "}}\n";
+        client.connection->send(out);
+    }
+    else if (type == "set") {
+        this->setProperty(client, node, identity, json["property"].asString().unwrapOr(""), json["value"]);
+    }
+    else {
+        client.connection->send("{\"type\":\"error\",\"message\":\"Unknown request\"}\n");
+    }
+}
+
+void InspectionServer::update() {
+    if (m_listenSocket != -1) {
+        this->acceptClients();
+    }
+    std::erase_if(m_clients, [](Client const& client) { return !client.connection->isOpen(); });
+
+    auto journal = SceneJournal::get();
+    if (m_clients.empty()) {
+        if (m_mirrorValid) {
+            m_mirrorValid = false;
+            m_mirror.clear();
+            m_mirrorByPointer.clear();
+            m_roots.clear();
+            m_changedProperties.clear();
+            m_pendingReorders.clear();
+            journal->setRecording(SceneJournalReader::Server, false);
+            SetterHooks::get()->setEnabled(SetterHookUser::Server, false);
+        }
+        return;
+    }
+    if (!m_mirrorValid) {
+        journal->setRecording(SceneJournalReader::Server, true);
+        SetterHooks::get()->setEnabled(SetterHookUser::Server, true);
+        this->rebuildMirror();
+        m_journalGeneration = journal->generation();
+    }
+
+    std::string line;
+    for (auto& client : m_clients) {
+        while (client.connection->isOpen() && client.connection->receive(line)) {
+            this->handleRequest(client, line);
+        }
+    }
+
+    bool resync = CCDirector::get()->getRunningScene() != m_mirrorScene;
+    if (!resync) {
+        // children only get sorted when they're next drawn, so reorders are looked at again next frame
+        auto parents = std::exchange(m_pendingReorders, {});
+        bool complete = journal->forEachSince(m_journalGeneration, [&](SceneChange const& change) {
+            switch (change.type) {
+                case SceneChangeType::SetID: {
+                    m_changedProperties.insert(change.node);
+                } break;
+
+                case SceneChangeType::RemoveAllChildren: {
+                    parents.insert(change.node);
+                } break;
+
+                case SceneChangeType::Reorder: {
+                    parents.insert(change.parent);
+                    m_pendingReorders.insert(change.parent);
+                } break;
+
+                case SceneChangeType::AddChild:
+                case SceneChangeType::RemoveChild: {
+                    parents.insert(change.parent);
+                } break;
+
+                default: break;
+            }
+        });
+        if (!complete) {
+            resync = true;
+        }
+        else {
+            for (auto parent : parents) {
+                auto it = m_mirrorByPointer.find(parent);
+                if (it != m_mirrorByPointer.end() && this->findNode(it->second) == parent) {
+                    this->reconcileChildren(it->second);
+                }
+            }
+            for (auto node : m_changedProperties) {
+                auto it = m_mirrorByPointer.find(node);
+                if (it == m_mirrorByPointer.end() || this->findNode(it->second) != node) continue;
+                this->beginChange();
+                fmt::format_to(std::back_inserter(m_delta), "{{\"op\":\"props\",\"node\":{},\"attributes\":{{", it->second);
+                appendNodeAttributes(m_delta, node);
+                m_delta += "}}";
+            }
+        }
+    }
+    m_changedProperties.clear();
+    m_journalGeneration = journal->generation();
+
+    if (resync) {
+        // whoever was following along gets a fresh copy of everything
+        this->rebuildMirror();
+        m_pendingReorders.clear();
+        m_deltaEmpty = true;
+        for (auto& client : m_clients) {
+            if (client.synced) {
+                this->sendTree(client);
+            }
+        }
+    }
+    else if (!m_deltaEmpty) {
+        m_delta += "]}\n";
+        for (auto& client : m_clients) {
+            if (client.synced) {
+                client.connection->send(m_delta);
+            }
+        }
+        m_deltaEmpty = true;
+    }
+
+    if (m_pendingSyncs) {
+        m_pendingSyncs = false;
+        for (auto& client : m_clients) {
+            if (client.authenticated && !client.synced) {
+                this->sendTree(client);
+            }
+        }
+    }
+}
+
+// runs whether or not the overlay is open
+class $modify(InspectionScheduler, CCScheduler) {
+    void update(float dt) override {
+        CCScheduler::update(dt);
+        auto server = InspectionServer::get();
+        if (server->isEnabled() || server->getClientCount()) {
+            server->update();
+        }
+    }
+};
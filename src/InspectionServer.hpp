@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <cocos2d.h>
+#include <matjson.hpp>
+
+// One client of the inspection server. Messages are single lines of JSON both ways.
+class InspectionConnection {
+public:
+    virtual ~InspectionConnection() = default;
+
+    // Pops the next complete line received from the client, if there is one
+    virtual bool receive(std::string& line) = 0;
+    virtual void send(std::string_view data) = 0;
+    virtual bool isOpen() const = 0;
+    virtual void close() = 0;
+};
+
+// In-memory connection, for driving the server from a client stub without touching the network
+class LoopbackConnection final : public InspectionConnection {
+protected:
+    std::deque<std::string> m_incoming;
+    std::string m_outgoing;
+    bool m_open = true;
+
+public:
+    // Queues a line as if the client had sent it
+    void push(std::string line);
+    // Everything the server sent since the last call
+    std::string take();
+
+    bool receive(std::string& line) override;
+    void send(std::string_view data) override;
+    bool isOpen() const override;
+    void close() override;
+};
+
+// Optional localhost server exposing the node tree to external tools.
+//
+// Any local process can connect, so the first message has to be
+// {"type":"hello","token":"..."} with the token written to `inspection-token` in the
+// save directory, which changes every time the game starts. Connections whose first
+// line looks like an HTTP request are dropped right away so a web page can't post to it.
+// It's plain TCP, a browser based client needs something in between that speaks WebSocket.
+//
+// A client sends {"type":"sync"} and gets the whole tree back as a "tree" message, with
+// nodes addressed by their NodeRegistry identity. From then on it gets at most one "delta"
+// message per frame, built from the scene journal and property setter hooks, listing
+// added subtrees, removed nodes, reordered children and nodes whose attributes changed.
+// {"type":"attributes","node":N} and {"type":"set","node":N,"property":...,"value":...}
+// read and edit single nodes.
+class InspectionServer {
+public:
+    static constexpr uint16_t PORT = 47823;
+
+protected:
+    struct Client {
+        std::unique_ptr<InspectionConnection> connection;
+        // sent the right token
+        bool authenticated = false;
+        bool synced = false;
+    };
+
+    // what the clients have been told about the tree so far
+    struct MirrorNode {
+        cocos2d::CCNode* node;
+        uint64_t parent;
+        std::vector<uint64_t> children;
+    };
+
+    std::vector<Client> m_clients;
+    std::unordered_map<uint64_t, MirrorNode> m_mirror;
+    std::unordered_map<cocos2d::CCNode*, uint64_t> m_mirrorByPointer;
+    std::vector<uint64_t> m_roots;
+    cocos2d::CCNode* m_mirrorScene = nullptr;
+    uint64_t m_journalGeneration = 0;
+    bool m_mirrorValid = false;
+    // filled by the property setter hooks, the pointers are only compared against the mirror
+    std::unordered_set<cocos2d::CCNode*> m_changedProperties;
+    std::unordered_set<cocos2d::CCNode*> m_pendingReorders;
+    bool m_pendingSyncs = false;
+    std::string m_delta;
+    bool m_deltaEmpty = true;
+    bool m_enabled = false;
+    intptr_t m_listenSocket = -1;
+    std::string m_token;
+
+    bool listen();
+    void closeListener();
+    void acceptClients();
+    void handleRequest(Client& client, std::string_view line);
+    void authenticate(Client& client, std::string_view line);
+    void setProperty(Client& client, cocos2d::CCNode* node, uint64_t identity, std::string const& property, matjson::Value const& value);
+
+    cocos2d::CCNode* findNode(uint64_t identity) const;
+    void rebuildMirror();
+    void mirrorBranch(cocos2d::CCNode* node, uint64_t parent, std::vector<uint64_t>& siblings, std::string* out);
+    void forgetBranch(uint64_t identity);
+    void appendMirrorNode(std::string& out, cocos2d::CCNode* node, uint64_t identity, uint64_t parent);
+    void reconcileChildren(uint64_t identity);
+    void beginChange();
+    void sendTree(Client& client);
+
+public:
+    static InspectionServer* get();
+
+    bool isEnabled() const;
+    // Starts or stops listening for TCP clients
+    void setEnabled(bool enabled);
+    void addConnection(std::unique_ptr<InspectionConnection> connection);
+    // Where clients read the token from
+    static std::filesystem::path getTokenPath();
+    // Writes the session token to getTokenPath, listening does this first
+    bool writeToken();
+    size_t getClientCount() const;
+
+    // Called by the property setter hooks
+    void propertiesChanged(cocos2d::CCNode* node);
+    // Handles requests and sends out the changes of the frame, called once per frame
+    void update();
+};
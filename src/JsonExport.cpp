@@ -0,0 +1,194 @@
+#include "JsonExport.hpp"
+#include "platform/utils.hpp"
+#include <Geode/utils/cocos.hpp>
+#include <cmath>
+
+using namespace geode::prelude;
+
+ChunkedFileWriter::~ChunkedFileWriter() {
+    this->close();
+}
+
+bool ChunkedFileWriter::open(std::filesystem::path const& path) {
+#ifdef GEODE_IS_WINDOWS
+    m_file = _wfopen(path.c_str(), L"wb");
+#else
+    m_file = std::fopen(path.c_str(), "wb");
+#endif
+    if (!m_file) return false;
+    m_current.reserve(CHUNK_SIZE + 4096);
+    m_thread = std::thread(&ChunkedFileWriter::run, this);
+    return true;
+}
+
+std::string& ChunkedFileWriter::buffer() {
+    return m_current;
+}
+
+void ChunkedFileWriter::commit() {
+    if (m_current.size() >= CHUNK_SIZE) {
+        this->flushChunk();
+    }
+}
+
+void ChunkedFileWriter::flushChunk() {
+    std::unique_lock lock(m_mutex);
+    m_changed.wait(lock, [this] { return m_queue.size() < MAX_QUEUED_CHUNKS || m_failed; });
+    m_queue.push_back(std::move(m_current));
+    // written chunks come back to be reused, so memory stays flat
+    if (!m_spare.empty()) {
+        m_current = std::move(m_spare.back());
+        m_spare.pop_back();
+    }
+    else {
+        m_current = std::string();
+        m_current.reserve(CHUNK_SIZE + 4096);
+    }
+    m_current.clear();
+    m_changed.notify_all();
+}
+
+void ChunkedFileWriter::run() {
+    while (true) {
+        std::string chunk;
+        {
+            std::unique_lock lock(m_mutex);
+            m_changed.wait(lock, [this] { return !m_queue.empty() || m_closing; });
+            if (m_queue.empty()) return;
+            chunk = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        bool ok = m_failed || std::fwrite(chunk.data(), 1, chunk.size(), m_file) == chunk.size();
+
+        std::lock_guard lock(m_mutex);
+        m_failed = !ok;
+        chunk.clear();
+        m_spare.push_back(std::move(chunk));
+        m_changed.notify_all();
+    }
+}
+
+bool ChunkedFileWriter::close() {
+    if (!m_file) return false;
+    if (!m_current.empty()) {
+        this->flushChunk();
+    }
+    {
+        std::lock_guard lock(m_mutex);
+        m_closing = true;
+        m_changed.notify_all();
+    }
+    m_thread.join();
+    bool ok = !m_failed && std::fclose(m_file) == 0;
+    m_file = nullptr;
+    return ok;
+}
+
+void appendJsonString(std::string& out, std::string_view str) {
+    out += '"';
+    for (char c : str) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default: {
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    fmt::format_to(std::back_inserter(out), "\\u{:04x}", static_cast<int>(c));
+                }
+                else {
+                    out += c;
+                }
+            } break;
+        }
+    }
+    out += '"';
+}
+
+void appendJsonNumber(std::string& out, float value) {
+    if (std::isfinite(value)) {
+        fmt::format_to(std::back_inserter(out), "{}", value);
+    }
+    else {
+        out += "null";
+    }
+}
+
+// mirrors what the Attributes page shows in its basic section
+void appendNodeAttributes(std::string& out, CCNode* node) {
+    auto it = std::back_inserter(out);
+    auto appendPair = [&](char const* name, float a, float b) {
+        fmt::format_to(it, ",\"{}\":[", name);
+        appendJsonNumber(out, a);
+        out += ',';
+        appendJsonNumber(out, b);
+        out += ']';
+    };
+
+    out += "\"class\":";
+    appendJsonString(out, getObjectClassName(node));
+    out += ",\"id\":";
+    appendJsonString(out, node->getID());
+    fmt::format_to(
+        it, ",\"address\":\"{}\",\"tag\":{},\"z_order\":{}",
+        fmt::ptr(node), node->getTag(), node->getZOrder()
+    );
+    appendPair("position", node->getPositionX(), node->getPositionY());
+    appendPair("scale", node->getScaleX(), node->getScaleY());
+    appendPair("rotation", node->getRotationX(), node->getRotationY());
+    appendPair("skew", node->getSkewX(), node->getSkewY());
+    appendPair("anchor_point", node->getAnchorPoint().x, node->getAnchorPoint().y);
+    appendPair("content_size", node->getContentWidth(), node->getContentHeight());
+    fmt::format_to(
+        it, ",\"visible\":{},\"ignore_anchor_point_for_position\":{}",
+        node->isVisible(), node->isIgnoreAnchorPointForPosition()
+    );
+    if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+        auto color = rgba->getColor();
+        fmt::format_to(it, ",\"color\":[{},{},{}],\"opacity\":{}", color.r, color.g, color.b, rgba->getOpacity());
+    }
+    if (auto layout = node->getLayout()) {
+        out += ",\"layout\":";
+        appendJsonString(out, getObjectClassName(layout));
+    }
+    if (auto opts = node->getLayoutOptions()) {
+        out += ",\"layout_options\":";
+        appendJsonString(out, getObjectClassName(opts));
+    }
+}
+
+namespace {
+    void writeNode(ChunkedFileWriter& writer, CCNode* node) {
+        auto& out = writer.buffer();
+        out += '{';
+        appendNodeAttributes(out, node);
+        out += ",\"children\":[";
+        writer.commit();
+        bool first = true;
+        for (auto child : CCArrayExt<CCNode*>(node->getChildren())) {
+            if (!first) writer.buffer() += ',';
+            first = false;
+            writeNode(writer, child);
+        }
+        writer.buffer() += "]}\n";
+        writer.commit();
+    }
+}
+
+std::string exportNodeJson(CCNode* root, std::filesystem::path const& path) {
+    if (!root) return "Nothing to export";
+
+    ChunkedFileWriter writer;
+    if (!writer.open(path)) {
+        return "Unable to open file for writing";
+    }
+    writer.buffer() += "{\"version\":1,\"root\":";
+    writeNode(writer, root);
+    writer.buffer() += "}\n";
+    if (!writer.close()) {
+        return "Unable to write file";
+    }
+    return "";
+}
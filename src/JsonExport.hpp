@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+#include <cocos2d.h>
+
+// Buffers writes into chunks and hands full chunks to a thread that writes them to disk,
+// so whoever produces the data never waits on the file system unless it gets far ahead.
+class ChunkedFileWriter final {
+public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+    // how far the producer can get ahead of the disk before it has to wait
+    static constexpr size_t MAX_QUEUED_CHUNKS = 64;
+
+private:
+    std::FILE* m_file = nullptr;
+    std::string m_current;
+    std::deque<std::string> m_queue;
+    std::vector<std::string> m_spare;
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::thread m_thread;
+    bool m_closing = false;
+    bool m_failed = false;
+
+    void run();
+    void flushChunk();
+
+public:
+    ChunkedFileWriter() = default;
+    ChunkedFileWriter(ChunkedFileWriter const&) = delete;
+    ChunkedFileWriter& operator=(ChunkedFileWriter const&) = delete;
+    ~ChunkedFileWriter();
+
+    bool open(std::filesystem::path const& path);
+    // The chunk being filled, append to it and call commit afterwards
+    std::string& buffer();
+    void commit();
+    // Waits for everything to be written, returns false if anything failed
+    bool close();
+};
+
+// Appends `str` as a quoted JSON string
+void appendJsonString(std::string& out, std::string_view str);
+// Appends `value` as a JSON number, or null if it's NaN or infinite which JSON can't represent
+void appendJsonNumber(std::string& out, float value);
+// Appends the attributes of `node` as JSON object members, without the braces
+void appendNodeAttributes(std::string& out, cocos2d::CCNode* node);
+
+// Streams the tree under `root` to `path` as JSON, returns an error message on failure
+std::string exportNodeJson(cocos2d::CCNode* root, std::filesystem::path const& path);
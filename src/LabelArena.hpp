@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Bump allocator for short-lived strings such as tree labels.
+// Strings stay valid until the next reset, which frees everything at once.
+class LabelArena {
+public:
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+protected:
+    struct Chunk {
+        std::unique_ptr<char[]> data;
+        size_t size;
+    };
+
+    std::vector<Chunk> m_chunks;
+    size_t m_current = 0;
+    size_t m_used = 0;
+    size_t m_total = 0;
+
+public:
+    // Copies `str` into the arena, the result is always null terminated
+    std::string_view store(std::string_view str) {
+        auto size = str.size() + 1;
+        if (m_chunks.empty() || m_used + size > m_chunks[m_current].size) {
+            m_current = m_chunks.empty() ? 0 : m_current + 1;
+            // reuse chunks kept around from before the last reset
+            while (m_current < m_chunks.size() && m_chunks[m_current].size < size) {
+                m_current += 1;
+            }
+            if (m_current >= m_chunks.size()) {
+                auto chunkSize = std::max(CHUNK_SIZE, size);
+                m_chunks.push_back({ std::make_unique<char[]>(chunkSize), chunkSize });
+                m_current = m_chunks.size() - 1;
+            }
+            m_used = 0;
+        }
+        auto ptr = m_chunks[m_current].data.get() + m_used;
+        std::memcpy(ptr, str.data(), str.size());
+        ptr[str.size()] = '\0';
+        m_used += size;
+        m_total += size;
+        return std::string_view(ptr, str.size());
+    }
+
+    // Bytes handed out since the last reset
+    size_t used() const {
+        return m_total;
+    }
+
+    void reset() {
+        m_current = 0;
+        m_used = 0;
+        m_total = 0;
+    }
+};
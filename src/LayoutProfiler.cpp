@@ -0,0 +1,105 @@
+#include "LayoutProfiler.hpp"
+#include "NodeRegistry.hpp"
+#include <Geode/loader/Mod.hpp>
+#include <Geode/utils/addresser.hpp>
+#include <chrono>
+
+using namespace geode::prelude;
+
+LayoutProfiler* LayoutProfiler::get() {
+    static auto inst = new LayoutProfiler();
+    return inst;
+}
+
+bool LayoutProfiler::isRecording() const {
+    return m_recording;
+}
+
+void LayoutProfiler::setRecording(bool recording) {
+    m_recording = recording;
+    m_stack.clear();
+}
+
+void LayoutProfiler::clear() {
+    m_stats.clear();
+}
+
+static bool isAncestorOf(CCNode* ancestor, CCNode* node) {
+    for (auto parent = node->getParent(); parent; parent = parent->getParent()) {
+        if (parent == ancestor) return true;
+    }
+    return false;
+}
+
+void LayoutProfiler::begin(CCNode* node) {
+    // a layout asking one of its ancestors to lay itself out again
+    if (!m_stack.empty() && isAncestorOf(node, m_stack.back())) {
+        m_stats[NodeRegistry::get()->identify(m_stack.back())].cascades += 1;
+    }
+    m_stack.push_back(node);
+}
+
+void LayoutProfiler::end(CCNode* node, double time) {
+    if (!m_stack.empty() && m_stack.back() == node) {
+        m_stack.pop_back();
+    }
+
+    auto frame = CCDirector::get()->getTotalFrames();
+    auto& stats = m_stats[NodeRegistry::get()->identify(node)];
+    if (stats.calls == 0 || stats.frame != frame) {
+        stats.streak = stats.calls != 0 && stats.frame + 1 == frame ? stats.streak + 1 : 1;
+        stats.frame = frame;
+        stats.frameCalls = 0;
+        stats.frameTime = 0.0;
+    }
+    stats.frameCalls += 1;
+    stats.frameTime += time;
+    stats.calls += 1;
+    stats.time += time;
+}
+
+LayoutStats const* LayoutProfiler::find(CCNode* node) const {
+    if (m_stats.empty()) return nullptr;
+    auto it = m_stats.find(NodeRegistry::get()->identify(node));
+    return it != m_stats.end() ? &it->second : nullptr;
+}
+
+std::unordered_map<uint64_t, LayoutStats> const& LayoutProfiler::stats() const {
+    return m_stats;
+}
+
+void LayoutProfiler::compact() {
+    auto registry = NodeRegistry::get();
+    std::erase_if(m_stats, [&](auto const& pair) {
+        return registry->find(pair.first) == nullptr;
+    });
+}
+
+bool LayoutProfiler::isEveryFrame(LayoutStats const& stats) {
+    return stats.streak >= EVERY_FRAME_STREAK && stats.frame + 1 >= CCDirector::get()->getTotalFrames();
+}
+
+// updateLayout lives in Geode rather than in the game, so it has to be hooked by hand.
+// Every layout (AxisLayout, SimpleAxisLayout, AnchorLayout...) is applied through it.
+static void CCNode_updateLayout(CCNode* self, bool updateChildOrder) {
+    auto profiler = LayoutProfiler::get();
+    if (!profiler->isRecording()) {
+        return self->updateLayout(updateChildOrder);
+    }
+
+    profiler->begin(self);
+    auto start = std::chrono::steady_clock::now();
+    self->updateLayout(updateChildOrder);
+    auto time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    profiler->end(self, time);
+}
+
+$execute {
+    (void) Mod::get()->hook(
+        reinterpret_cast<void*>(addresser::getNonVirtual(
+            static_cast<void(CCNode::*)(bool)>(&CCNode::updateLayout)
+        )),
+        &CCNode_updateLayout,
+        "cocos2d::CCNode::updateLayout"
+    );
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <cocos2d.h>
+
+struct LayoutStats {
+    // frame (CCDirector::getTotalFrames) of the last layout
+    unsigned int frame = 0;
+    // within that frame
+    uint32_t frameCalls = 0;
+    double frameTime = 0.0;
+    // frames in a row the node was laid out in
+    uint32_t streak = 0;
+    // since recording started, times include layouts nested inside this one
+    size_t calls = 0;
+    double time = 0.0;
+    // times laying this node out made one of its ancestors lay itself out again
+    size_t cascades = 0;
+};
+
+// Counts and times every CCNode::updateLayout while recording, keyed by node identity.
+// Layouts applied while another layout is running are tracked so a child forcing its
+// parent to be laid out again can be pointed out.
+class LayoutProfiler {
+public:
+    // laid out this many frames in a row counts as every frame
+    static constexpr uint32_t EVERY_FRAME_STREAK = 30;
+
+protected:
+    std::unordered_map<uint64_t, LayoutStats> m_stats;
+    // nodes being laid out right now, innermost last
+    std::vector<cocos2d::CCNode*> m_stack;
+    bool m_recording = false;
+
+public:
+    static LayoutProfiler* get();
+
+    bool isRecording() const;
+    void setRecording(bool recording);
+    void clear();
+
+    void begin(cocos2d::CCNode* node);
+    // `time` is in milliseconds
+    void end(cocos2d::CCNode* node, double time);
+
+    // Null if the node hasn't been laid out since recording started
+    LayoutStats const* find(cocos2d::CCNode* node) const;
+    std::unordered_map<uint64_t, LayoutStats> const& stats() const;
+    // Drops the stats of destroyed nodes
+    void compact();
+
+    // Whether the node kept being laid out up to the current frame
+    static bool isEveryFrame(LayoutStats const& stats);
+};
@@ -0,0 +1,17 @@
+#include "NodeLabel.hpp"
+#include <fmt/format.h>
+#include <iterator>
+
+void formatNodeNameTo(std::string& out, NodeLabelParts const& parts) {
+    auto it = std::back_inserter(out);
+    fmt::format_to(it, "[{}{}{}] {} ", parts.fake ? "*" : "", parts.flagHidden ? "..." : "", parts.index, parts.className);
+    if (parts.tag != -1) {
+        fmt::format_to(it, "({}) ", parts.tag);
+    }
+    if (parts.id.size()) {
+        fmt::format_to(it, "\"{}\" ", parts.id);
+    }
+    if (parts.childCount) {
+        fmt::format_to(it, "<{}> ", parts.childCount);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// What goes into the Tree label of a node, read off the node by the caller.
+// Nothing here depends on Geode, so the formatting can be benchmarked on its own.
+struct NodeLabelParts {
+    std::string_view className;
+    std::string_view id;
+    int tag = -1;
+    size_t childCount = 0;
+    // among its siblings
+    size_t index = 0;
+    bool fake = false;
+    bool flagHidden = false;
+};
+
+// Appends `[index] Class (tag) "id" <children> `, leaving out the tag, id and children if there are none
+void formatNodeNameTo(std::string& out, NodeLabelParts const& parts);
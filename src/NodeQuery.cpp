@@ -0,0 +1,320 @@
+#include "NodeQuery.hpp"
+#include <array>
+#include <cctype>
+#include <charconv>
+
+namespace {
+    char lower(char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    }
+
+    std::string toLower(std::string_view str) {
+        std::string ret(str);
+        for (auto& c : ret) c = lower(c);
+        return ret;
+    }
+
+    bool hasWildcards(std::string_view pattern) {
+        return pattern.find_first_of("*?") != std::string_view::npos;
+    }
+
+    // `pattern` is expected to be lowercase already
+    bool globMatch(std::string_view pattern, std::string_view str) {
+        size_t p = 0, s = 0;
+        size_t starP = std::string_view::npos, starS = 0;
+        while (s < str.size()) {
+            if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == lower(str[s]))) {
+                p += 1;
+                s += 1;
+            }
+            else if (p < pattern.size() && pattern[p] == '*') {
+                starP = p++;
+                starS = s;
+            }
+            else if (starP != std::string_view::npos) {
+                p = starP + 1;
+                s = ++starS;
+            }
+            else {
+                return false;
+            }
+        }
+        while (p < pattern.size() && pattern[p] == '*') p += 1;
+        return p == pattern.size();
+    }
+
+    bool containsLower(std::string_view str, std::string_view needle) {
+        if (needle.size() > str.size()) return false;
+        for (size_t i = 0; i + needle.size() <= str.size(); i++) {
+            size_t j = 0;
+            while (j < needle.size() && lower(str[i + j]) == needle[j]) j += 1;
+            if (j == needle.size()) return true;
+        }
+        return false;
+    }
+
+    bool textMatch(std::string_view pattern, std::string_view str) {
+        if (hasWildcards(pattern)) {
+            return globMatch(pattern, str);
+        }
+        return pattern.size() == str.size() && containsLower(str, pattern);
+    }
+
+    // Class names are namespaced (`cocos2d::CCMenu`), so unless the pattern names a
+    // namespace itself it also gets to match the name without it
+    bool classMatch(std::string_view pattern, std::string_view className) {
+        if (textMatch(pattern, className)) return true;
+        if (pattern.find("::") != std::string_view::npos) return false;
+        auto separator = className.rfind("::");
+        return separator != std::string_view::npos && textMatch(pattern, className.substr(separator + 2));
+    }
+
+    bool compare(long long value, NodeQuery::Op op, long long number) {
+        switch (op) {
+            case NodeQuery::Op::Equal: return value == number;
+            case NodeQuery::Op::NotEqual: return value != number;
+            case NodeQuery::Op::Less: return value < number;
+            case NodeQuery::Op::LessEqual: return value <= number;
+            case NodeQuery::Op::Greater: return value > number;
+            case NodeQuery::Op::GreaterEqual: return value >= number;
+        }
+        return false;
+    }
+
+    struct FieldName {
+        std::string_view name;
+        NodeQuery::Field field;
+    };
+
+    constexpr std::array FIELD_NAMES = {
+        FieldName { "class", NodeQuery::Field::Class },
+        FieldName { "id", NodeQuery::Field::ID },
+        FieldName { "tag", NodeQuery::Field::Tag },
+        FieldName { "visible", NodeQuery::Field::Visible },
+        FieldName { "children", NodeQuery::Field::Children },
+    };
+
+    struct OpName {
+        std::string_view name;
+        NodeQuery::Op op;
+    };
+
+    // longer operators first so `>=` isn't read as `>`
+    constexpr std::array OP_NAMES = {
+        OpName { "!=", NodeQuery::Op::NotEqual },
+        OpName { "<=", NodeQuery::Op::LessEqual },
+        OpName { ">=", NodeQuery::Op::GreaterEqual },
+        OpName { ":", NodeQuery::Op::Equal },
+        OpName { "=", NodeQuery::Op::Equal },
+        OpName { "<", NodeQuery::Op::Less },
+        OpName { ">", NodeQuery::Op::Greater },
+    };
+
+    bool isFieldName(std::string_view str) {
+        for (auto& [name, field] : FIELD_NAMES) {
+            if (str.size() == name.size() && toLower(str) == name) return true;
+        }
+        return false;
+    }
+
+    std::optional<NodeQuery::Term> parseTerm(std::string_view token, bool inPath, std::string& error) {
+        NodeQuery::Term term;
+
+        if (token == "*") {
+            term.field = NodeQuery::Field::Any;
+            return term;
+        }
+
+        for (auto& [name, field] : FIELD_NAMES) {
+            if (token.size() <= name.size() || toLower(token.substr(0, name.size())) != name) {
+                continue;
+            }
+            auto rest = token.substr(name.size());
+            for (auto& [opName, op] : OP_NAMES) {
+                if (!rest.starts_with(opName)) continue;
+
+                auto value = rest.substr(opName.size());
+                if (value.empty()) {
+                    error = "Missing value for '" + std::string(name) + "'";
+                    return std::nullopt;
+                }
+
+                term.field = field;
+                term.op = op;
+                switch (field) {
+                    case NodeQuery::Field::Class:
+                    case NodeQuery::Field::ID: {
+                        if (op != NodeQuery::Op::Equal && op != NodeQuery::Op::NotEqual) {
+                            error = "'" + std::string(name) + "' can only be compared with ':' or '!='";
+                            return std::nullopt;
+                        }
+                        term.text = toLower(value);
+                    } break;
+
+                    case NodeQuery::Field::Visible: {
+                        if (op != NodeQuery::Op::Equal && op != NodeQuery::Op::NotEqual) {
+                            error = "'visible' can only be compared with ':' or '!='";
+                            return std::nullopt;
+                        }
+                        auto lowered = toLower(value);
+                        if (lowered == "true" || lowered == "yes" || lowered == "1") {
+                            term.number = 1;
+                        }
+                        else if (lowered == "false" || lowered == "no" || lowered == "0") {
+                            term.number = 0;
+                        }
+                        else {
+                            error = "Expected true or false for 'visible'";
+                            return std::nullopt;
+                        }
+                    } break;
+
+                    default: {
+                        auto [end, ec] = std::from_chars(value.data(), value.data() + value.size(), term.number);
+                        if (ec != std::errc() || end != value.data() + value.size()) {
+                            error = "Expected a number for '" + std::string(name) + "'";
+                            return std::nullopt;
+                        }
+                    } break;
+                }
+                return term;
+            }
+        }
+
+        // plain words
+        term.text = toLower(token);
+        if (inPath) {
+            term.field = NodeQuery::Field::Class;
+        }
+        else {
+            term.field = NodeQuery::Field::Text;
+        }
+        return term;
+    }
+}
+
+std::optional<NodeQuery> NodeQuery::parse(std::string_view source, std::string* error) {
+    // `>` and `>>` don't need spaces around them, unless the `>` is the operator of a field
+    // (`children>10`, `tag>=5`)
+    std::vector<std::string_view> tokens;
+    size_t i = 0;
+    while (i < source.size()) {
+        if (std::isspace(static_cast<unsigned char>(source[i]))) {
+            i += 1;
+            continue;
+        }
+        if (source[i] == '>') {
+            auto size = i + 1 < source.size() && source[i + 1] == '>' ? 2 : 1;
+            tokens.push_back(source.substr(i, size));
+            i += size;
+            continue;
+        }
+        auto start = i;
+        while (i < source.size() && !std::isspace(static_cast<unsigned char>(source[i]))) {
+            if (source[i] == '>' && !isFieldName(source.substr(start, i - start))) break;
+            i += 1;
+        }
+        tokens.push_back(source.substr(start, i - start));
+    }
+
+    bool inPath = false;
+    for (auto token : tokens) {
+        if (token == ">" || token == ">>") inPath = true;
+    }
+
+    NodeQuery query;
+    std::string err;
+    query.m_steps.emplace_back();
+    for (auto token : tokens) {
+        if (token == ">" || token == ">>") {
+            if (query.m_steps.back().terms.empty()) {
+                err = "Expected a selector before '" + std::string(token) + "'";
+                break;
+            }
+            query.m_steps.emplace_back();
+            query.m_steps.back().combinator = token == ">" ? Combinator::Child : Combinator::Descendant;
+            continue;
+        }
+        auto term = parseTerm(token, inPath, err);
+        if (!term) break;
+        query.m_steps.back().terms.push_back(std::move(*term));
+    }
+    if (err.empty() && query.m_steps.size() > 1 && query.m_steps.back().terms.empty()) {
+        err = "Expected a selector at the end of the path";
+    }
+
+    if (!err.empty()) {
+        if (error) *error = std::move(err);
+        return std::nullopt;
+    }
+    if (query.m_steps.back().terms.empty()) {
+        query.m_steps.clear();
+    }
+    return query;
+}
+
+bool NodeQuery::empty() const {
+    return m_steps.empty();
+}
+
+bool NodeQuery::matchesStep(Step const& step, NodeQueryInput const& node) const {
+    for (auto& term : step.terms) {
+        bool matched = true;
+        switch (term.field) {
+            case Field::Any: break;
+
+            case Field::Text: {
+                matched = hasWildcards(term.text) ?
+                    globMatch(term.text, node.className) || globMatch(term.text, node.id) :
+                    containsLower(node.className, term.text) || containsLower(node.id, term.text);
+            } break;
+
+            case Field::Class: {
+                matched = classMatch(term.text, node.className) == (term.op == Op::Equal);
+            } break;
+
+            case Field::ID: {
+                matched = textMatch(term.text, node.id) == (term.op == Op::Equal);
+            } break;
+
+            case Field::Tag: {
+                matched = compare(node.tag, term.op, term.number);
+            } break;
+
+            case Field::Visible: {
+                matched = compare(node.visible ? 1 : 0, term.op, term.number);
+            } break;
+
+            case Field::Children: {
+                matched = compare(static_cast<long long>(node.childCount), term.op, term.number);
+            } break;
+        }
+        if (!matched) return false;
+    }
+    return true;
+}
+
+bool NodeQuery::matchesFrom(size_t step, std::span<NodeQueryInput const> path) const {
+    if (path.empty() || !this->matchesStep(m_steps[step], path.back())) {
+        return false;
+    }
+    if (step == 0) {
+        return true;
+    }
+
+    auto ancestors = path.first(path.size() - 1);
+    if (m_steps[step].combinator == Combinator::Child) {
+        return this->matchesFrom(step - 1, ancestors);
+    }
+    for (size_t size = ancestors.size(); size > 0; size--) {
+        if (this->matchesFrom(step - 1, ancestors.first(size))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NodeQuery::matches(std::span<NodeQueryInput const> path) const {
+    if (m_steps.empty()) return true;
+    return this->matchesFrom(m_steps.size() - 1, path);
+}
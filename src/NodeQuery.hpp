@@ -0,0 +1,80 @@
+#pragma once
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// What a query gets to see of a node, so queries can run on live nodes as well as copies of them
+struct NodeQueryInput {
+    std::string_view className;
+    std::string_view id;
+    int tag = -1;
+    bool visible = true;
+    size_t childCount = 0;
+};
+
+// A compiled Tree search query.
+//
+// A query is a list of terms separated by spaces, all of which have to match:
+//   class:CCMenuItemSpriteExtra  id:*-button  tag:5  visible:true  children>10
+// Text fields support `*` and `?` wildcards and `!=`, numeric fields support
+// `:`/`=`, `!=`, `<`, `<=`, `>` and `>=`. Everything is case insensitive.
+//
+// Steps can be chained with `>` (direct child) or `>>` (any descendant), for example
+// `MenuLayer > CCMenu > *`. A bare word is a class name in a path, and a substring of
+// the class name or ID otherwise, which keeps plain searches working like before.
+// Class names match with or without their namespace, `CCMenu` finds `cocos2d::CCMenu`.
+class NodeQuery {
+public:
+    enum class Field {
+        Any,
+        Text,
+        Class,
+        ID,
+        Tag,
+        Visible,
+        Children,
+    };
+
+    enum class Op {
+        Equal,
+        NotEqual,
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+    };
+
+    enum class Combinator {
+        Child,
+        Descendant,
+    };
+
+    struct Term {
+        Field field = Field::Any;
+        Op op = Op::Equal;
+        std::string text;
+        long long number = 0;
+    };
+
+    struct Step {
+        std::vector<Term> terms;
+        // how this step relates to the previous one
+        Combinator combinator = Combinator::Descendant;
+    };
+
+protected:
+    std::vector<Step> m_steps;
+
+    bool matchesStep(Step const& step, NodeQueryInput const& node) const;
+    bool matchesFrom(size_t step, std::span<NodeQueryInput const> path) const;
+
+public:
+    static std::optional<NodeQuery> parse(std::string_view source, std::string* error = nullptr);
+
+    bool empty() const;
+    // `path` is the node being tested preceded by its ancestors, root first
+    bool matches(std::span<NodeQueryInput const> path) const;
+};
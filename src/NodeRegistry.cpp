@@ -0,0 +1,61 @@
+#include "NodeRegistry.hpp"
+#include <Geode/modify/CCNode.hpp>
+
+using namespace geode::prelude;
+
+// fields are destroyed along with their node, which is the closest thing to a destructor hook
+class $modify(NodeIdentity, CCNode) {
+    struct Fields {
+        uint64_t m_identity = 0;
+
+        ~Fields() {
+            if (m_identity) {
+                NodeRegistry::get()->release(m_identity);
+            }
+        }
+    };
+};
+
+NodeRegistry* NodeRegistry::get() {
+    static auto inst = new NodeRegistry();
+    return inst;
+}
+
+uint64_t NodeRegistry::identify(CCNode* node) {
+    if (!node) return 0;
+    auto& identity = static_cast<NodeIdentity*>(node)->m_fields->m_identity;
+    if (!identity) {
+        identity = m_nextIdentity++;
+        m_nodes[identity] = node;
+    }
+    return identity;
+}
+
+CCNode* NodeRegistry::find(uint64_t identity) const {
+    auto it = m_nodes.find(identity);
+    return it != m_nodes.end() ? it->second : nullptr;
+}
+
+size_t NodeRegistry::size() const {
+    return m_nodes.size();
+}
+
+// nobody is draining the list while DevTools is closed
+static constexpr size_t MAX_PENDING_RELEASES = 64 * 1024;
+
+void NodeRegistry::release(uint64_t identity) {
+    m_nodes.erase(identity);
+    if (m_releasedOverflow) return;
+    if (m_released.size() >= MAX_PENDING_RELEASES) {
+        m_released.clear();
+        m_releasedOverflow = true;
+        return;
+    }
+    m_released.push_back(identity);
+}
+
+bool NodeRegistry::takeReleased(std::vector<uint64_t>& released) {
+    released.swap(m_released);
+    m_released.clear();
+    return !std::exchange(m_releasedOverflow, false);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include <cocos2d.h>
+
+// Hands out stable 64-bit identities to nodes, so per-node state doesn't have to be keyed
+// by raw pointers that outlive their node and get reused by the next allocation.
+// Identities are never reused and are released when their node is destroyed.
+class NodeRegistry {
+protected:
+    uint64_t m_nextIdentity = 1;
+    std::unordered_map<uint64_t, cocos2d::CCNode*> m_nodes;
+    std::vector<uint64_t> m_released;
+    bool m_releasedOverflow = false;
+
+public:
+    static NodeRegistry* get();
+
+    // Identity of the node, assigned on first sight
+    uint64_t identify(cocos2d::CCNode* node);
+    // Node with the given identity, or null if it was destroyed
+    cocos2d::CCNode* find(uint64_t identity) const;
+    size_t size() const;
+
+    // Called when a node with an identity is destroyed
+    void release(uint64_t identity);
+    // Identities released since the last call, for dropping state kept on them.
+    // Returns false if too many piled up to keep track of, every identity then has to be checked with find.
+    bool takeReleased(std::vector<uint64_t>& released);
+};
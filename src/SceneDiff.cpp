@@ -0,0 +1,213 @@
+#include "SceneDiff.hpp"
+#include "NodeRegistry.hpp"
+#include "platform/utils.hpp"
+#include <Geode/utils/cocos.hpp>
+#include <algorithm>
+#include <tuple>
+#include <unordered_map>
+
+using namespace geode::prelude;
+
+namespace {
+    struct Sibling {
+        std::string_view className;
+        std::string_view id;
+        size_t index;
+    };
+
+    struct CaptureState {
+        SceneCapture& capture;
+        std::string path;
+        uint64_t parentIdentity = 0;
+        // the children of every node on the way down, reused so nothing is allocated per node
+        std::vector<Sibling> siblings;
+        std::vector<size_t> ordinals;
+    };
+
+    void captureBranch(CaptureState& state, CCNode* node) {
+        auto& capture = state.capture;
+        uint8_t opacity = 255;
+        if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+            opacity = rgba->getOpacity();
+        }
+
+        auto id = std::string_view(node->getID());
+        auto identity = NodeRegistry::get()->identify(node);
+        capture.nodes.push_back({
+            .identity = identity,
+            .parentIdentity = state.parentIdentity,
+            .pathOffset = capture.strings.size(),
+            .pathLength = state.path.size(),
+            .idOffset = capture.strings.size() + state.path.size(),
+            .idLength = id.size(),
+            .x = node->getPositionX(),
+            .y = node->getPositionY(),
+            .scaleX = node->getScaleX(),
+            .scaleY = node->getScaleY(),
+            .rotation = node->getRotation(),
+            .zOrder = node->getZOrder(),
+            .tag = node->getTag(),
+            .opacity = opacity,
+            .visible = node->isVisible(),
+        });
+        capture.strings.append(state.path);
+        capture.strings.append(id);
+
+        if (!node->getChildrenCount()) return;
+
+        // siblings that look the same are told apart by how many came before them, this
+        // shifts when one is inserted but the diff goes by identity for those.
+        // Sorting them puts the lookalikes next to each other in their original order.
+        auto start = state.siblings.size();
+        for (auto child : CCArrayExt<CCNode*>(node->getChildren())) {
+            state.siblings.push_back({ getObjectClassName(child), std::string_view(child->getID()), state.siblings.size() - start });
+        }
+        std::sort(state.siblings.begin() + start, state.siblings.end(), [](Sibling const& a, Sibling const& b) {
+            return std::tie(a.className, a.id, a.index) < std::tie(b.className, b.id, b.index);
+        });
+        state.ordinals.resize(state.siblings.size());
+        for (auto i = start; i < state.siblings.size(); i++) {
+            auto& sibling = state.siblings[i];
+            size_t ordinal = 0;
+            if (i > start) {
+                auto& previous = state.siblings[i - 1];
+                if (previous.className == sibling.className && previous.id == sibling.id) {
+                    ordinal = state.ordinals[start + previous.index] + 1;
+                }
+            }
+            state.ordinals[start + sibling.index] = ordinal;
+        }
+
+        auto parentLength = state.path.size();
+        auto parentIdentity = state.parentIdentity;
+        state.parentIdentity = identity;
+        size_t index = 0;
+        for (auto child : CCArrayExt<CCNode*>(node->getChildren())) {
+            auto childID = std::string_view(child->getID());
+            state.path.resize(parentLength);
+            state.path += '/';
+            state.path += getObjectClassName(child);
+            if (!childID.empty()) {
+                state.path += '#';
+                state.path += childID;
+            }
+            fmt::format_to(std::back_inserter(state.path), "[{}]", state.ordinals[start + index++]);
+            captureBranch(state, child);
+        }
+        state.path.resize(parentLength);
+        state.parentIdentity = parentIdentity;
+        state.siblings.resize(start);
+        state.ordinals.resize(start);
+    }
+
+    uint8_t diffFields(SceneCapture::Node const& a, SceneCapture::Node const& b) {
+        uint8_t fields = 0;
+        if (a.x != b.x || a.y != b.y) fields |= scene_diff_field::Position;
+        if (a.scaleX != b.scaleX || a.scaleY != b.scaleY) fields |= scene_diff_field::Scale;
+        if (a.rotation != b.rotation) fields |= scene_diff_field::Rotation;
+        if (a.visible != b.visible) fields |= scene_diff_field::Visible;
+        if (a.zOrder != b.zOrder) fields |= scene_diff_field::ZOrder;
+        if (a.tag != b.tag) fields |= scene_diff_field::Tag;
+        if (a.opacity != b.opacity) fields |= scene_diff_field::Opacity;
+        return fields;
+    }
+}
+
+SceneCapture SceneCapture::capture(CCNode* root, std::string name) {
+    SceneCapture capture;
+    capture.name = std::move(name);
+    if (!root) return capture;
+
+    CaptureState state { .capture = capture };
+    state.path = getObjectClassName(root);
+    captureBranch(state, root);
+
+    std::vector<size_t> order(capture.nodes.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return capture.getPath(capture.nodes[a]) < capture.getPath(capture.nodes[b]);
+    });
+    std::vector<Node> sorted;
+    sorted.reserve(order.size());
+    for (auto i : order) sorted.push_back(capture.nodes[i]);
+    capture.nodes = std::move(sorted);
+    return capture;
+}
+
+std::string_view SceneCapture::getPath(Node const& node) const {
+    return std::string_view(strings).substr(node.pathOffset, node.pathLength);
+}
+
+std::string_view SceneCapture::getID(Node const& node) const {
+    return std::string_view(strings).substr(node.idOffset, node.idLength);
+}
+
+std::vector<SceneDiffEntry> diffScenes(SceneCapture const& before, SceneCapture const& after) {
+    std::vector<SceneDiffEntry> entries;
+    std::vector<size_t> removed;
+    std::vector<size_t> added;
+
+    size_t i = 0, j = 0;
+    while (i < before.nodes.size() || j < after.nodes.size()) {
+        if (j == after.nodes.size()) {
+            removed.push_back(i++);
+            continue;
+        }
+        if (i == before.nodes.size()) {
+            added.push_back(j++);
+            continue;
+        }
+        auto cmp = before.getPath(before.nodes[i]).compare(after.getPath(after.nodes[j]));
+        if (cmp < 0) {
+            removed.push_back(i++);
+        }
+        else if (cmp > 0) {
+            added.push_back(j++);
+        }
+        else if (before.nodes[i].identity != after.nodes[j].identity) {
+            // destroyed and replaced by a new node, or another sibling took its index
+            removed.push_back(i++);
+            added.push_back(j++);
+        }
+        else {
+            if (auto fields = diffFields(before.nodes[i], after.nodes[j])) {
+                entries.push_back({ SceneDiffKind::Changed, fields, i, j });
+            }
+            i += 1;
+            j += 1;
+        }
+    }
+
+    // a removed and an added path with the same node behind them is a move, unless it's
+    // still under the same parent and just got renumbered
+    std::unordered_map<uint64_t, size_t> removedByIdentity;
+    removedByIdentity.reserve(removed.size());
+    for (auto index : removed) {
+        removedByIdentity.emplace(before.nodes[index].identity, index);
+    }
+    std::vector<bool> moved(before.nodes.size(), false);
+    for (auto index : added) {
+        auto it = removedByIdentity.find(after.nodes[index].identity);
+        if (it != removedByIdentity.end() && !moved[it->second]) {
+            moved[it->second] = true;
+            auto const& beforeNode = before.nodes[it->second];
+            auto const& afterNode = after.nodes[index];
+            auto fields = diffFields(beforeNode, afterNode);
+            if (beforeNode.parentIdentity != afterNode.parentIdentity) {
+                entries.push_back({ SceneDiffKind::Moved, fields, it->second, index });
+            }
+            else if (fields) {
+                entries.push_back({ SceneDiffKind::Changed, fields, it->second, index });
+            }
+        }
+        else {
+            entries.push_back({ SceneDiffKind::Added, 0, SceneDiffEntry::NO_NODE, index });
+        }
+    }
+    for (auto index : removed) {
+        if (!moved[index]) {
+            entries.push_back({ SceneDiffKind::Removed, 0, index, SceneDiffEntry::NO_NODE });
+        }
+    }
+    return entries;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// only handled as opaque pointers, so this compiles without the cocos headers
+namespace cocos2d {
+    class CCNode;
+}
+
+// Compact copy of a scene graph, one flat struct per node, for comparing scenes over time.
+// Nodes are addressed by a path of class names, IDs and sibling indices, which is what
+// lines them up between two captures, as long as the same node object is behind both.
+struct SceneCapture {
+    struct Node {
+        uint64_t identity;
+        // 0 for the root
+        uint64_t parentIdentity;
+        size_t pathOffset;
+        size_t pathLength;
+        size_t idOffset;
+        size_t idLength;
+        float x;
+        float y;
+        float scaleX;
+        float scaleY;
+        float rotation;
+        int zOrder;
+        int tag;
+        uint8_t opacity;
+        bool visible;
+    };
+
+    std::string name;
+    // sorted by path
+    std::vector<Node> nodes;
+    // paths and IDs back to back, to avoid an allocation per node
+    std::string strings;
+
+    static SceneCapture capture(cocos2d::CCNode* root, std::string name);
+
+    std::string_view getPath(Node const& node) const;
+    std::string_view getID(Node const& node) const;
+};
+
+enum class SceneDiffKind : uint8_t {
+    Added,
+    Removed,
+    // same node, different parent
+    Moved,
+    Changed,
+};
+
+namespace scene_diff_field {
+    enum : uint8_t {
+        Position = 1 << 0,
+        Scale    = 1 << 1,
+        Rotation = 1 << 2,
+        Visible  = 1 << 3,
+        ZOrder   = 1 << 4,
+        Tag      = 1 << 5,
+        Opacity  = 1 << 6,
+    };
+}
+
+struct SceneDiffEntry {
+    static constexpr size_t NO_NODE = static_cast<size_t>(-1);
+
+    SceneDiffKind kind;
+    // scene_diff_field bits of what differs, for changed and moved nodes
+    uint8_t fields;
+    // indices into the before and after captures
+    size_t before;
+    size_t after;
+};
+
+// Merges the two sorted captures in a single pass, nodes that are removed on one side
+// and added on the other are reported as moved if they are the same node object under
+// another parent. Only its sibling index changing doesn't make a node moved.
+std::vector<SceneDiffEntry> diffScenes(SceneCapture const& before, SceneCapture const& after);
@@ -0,0 +1,159 @@
+#include "SceneJournal.hpp"
+#include <Geode/modify/CCNode.hpp>
+#include <Geode/loader/Mod.hpp>
+#include <Geode/utils/addresser.hpp>
+
+using namespace geode::prelude;
+
+SceneJournal* SceneJournal::get() {
+    static auto inst = new SceneJournal();
+    return inst;
+}
+
+void SceneJournal::record(SceneChangeType type, CCNode* node, CCNode* parent) {
+    m_entries[m_generation % CAPACITY] = { type, node, parent };
+    m_generation += 1;
+}
+
+uint64_t SceneJournal::generation() const {
+    return m_generation;
+}
+
+void SceneJournal::reset() {
+    m_validFrom = m_generation;
+}
+
+bool SceneJournal::isRecording() const {
+    return m_readers != 0;
+}
+
+void SceneJournal::setRecording(SceneJournalReader reader, bool recording) {
+    // whatever happened while nobody was looking is lost
+    if (recording && !m_readers) {
+        this->reset();
+    }
+    if (recording) {
+        m_readers |= static_cast<uint8_t>(reader);
+    }
+    else {
+        m_readers &= ~static_cast<uint8_t>(reader);
+    }
+}
+
+// removeFromParentAndCleanup and friends all go through removeChild
+class $modify(SceneJournalNode, CCNode) {
+    void addChild(CCNode* child, int zOrder, int tag) override {
+        CCNode::addChild(child, zOrder, tag);
+        auto journal = SceneJournal::get();
+        if (journal->isRecording()) {
+            journal->record(SceneChangeType::AddChild, child, this);
+        }
+    }
+
+    void removeChild(CCNode* child, bool cleanup) override {
+        auto journal = SceneJournal::get();
+        if (journal->isRecording()) {
+            journal->record(SceneChangeType::RemoveChild, child, this);
+        }
+        CCNode::removeChild(child, cleanup);
+    }
+
+    void removeAllChildrenWithCleanup(bool cleanup) override {
+        auto journal = SceneJournal::get();
+        if (journal->isRecording()) {
+            journal->record(SceneChangeType::RemoveAllChildren, this, this);
+        }
+        CCNode::removeAllChildrenWithCleanup(cleanup);
+    }
+
+    void reorderChild(CCNode* child, int zOrder) override {
+        CCNode::reorderChild(child, zOrder);
+        auto journal = SceneJournal::get();
+        if (journal->isRecording()) {
+            journal->record(SceneChangeType::Reorder, child, this);
+        }
+    }
+
+    void setZOrder(int zOrder) override {
+        CCNode::setZOrder(zOrder);
+        auto journal = SceneJournal::get();
+        if (journal->isRecording()) {
+            journal->record(SceneChangeType::Reorder, this, this->getParent());
+        }
+    }
+
+    // plenty of nodes get set to what they already are every frame
+    void setVisible(bool visible) override {
+        bool changed = visible != this->isVisible();
+        CCNode::setVisible(visible);
+        auto journal = SceneJournal::get();
+        if (changed && journal->isRecording()) {
+            journal->record(SceneChangeType::SetVisible, this, this->getParent());
+        }
+    }
+};
+
+// these live in Geode rather than in the game, so they have to be hooked by hand
+static void CCNode_setID(CCNode* self, std::string const& id) {
+    self->setID(id);
+    auto journal = SceneJournal::get();
+    if (journal->isRecording()) {
+        journal->record(SceneChangeType::SetID, self, self->getParent());
+    }
+}
+
+static void CCNode_setLayout(CCNode* self, Layout* layout, bool apply, bool respectAnchor) {
+    bool changed = (layout != nullptr) != (self->getLayout() != nullptr);
+    self->setLayout(layout, apply, respectAnchor);
+    auto journal = SceneJournal::get();
+    if (changed && journal->isRecording()) {
+        journal->record(SceneChangeType::SetLayout, self, self->getParent());
+    }
+}
+
+static void CCNode_setUserObject(CCNode* self, std::string const& id, CCObject* value) {
+    self->setUserObject(id, value);
+    auto journal = SceneJournal::get();
+    if (journal->isRecording() && id == "extra-children"_spr) {
+        journal->record(SceneChangeType::SetUserObject, self, self->getParent());
+    }
+}
+
+static void CCNode_setUserFlag(CCNode* self, std::string const& id, bool state) {
+    self->setUserFlag(id, state);
+    auto journal = SceneJournal::get();
+    if (journal->isRecording() && id == "hide"_spr) {
+        journal->record(SceneChangeType::SetUserFlag, self, self->getParent());
+    }
+}
+
+$execute {
+    (void) Mod::get()->hook(
+        reinterpret_cast<void*>(addresser::getNonVirtual(
+            static_cast<void(CCNode::*)(std::string const&)>(&CCNode::setID)
+        )),
+        &CCNode_setID,
+        "cocos2d::CCNode::setID"
+    );
+    (void) Mod::get()->hook(
+        reinterpret_cast<void*>(addresser::getNonVirtual(
+            static_cast<void(CCNode::*)(Layout*, bool, bool)>(&CCNode::setLayout)
+        )),
+        &CCNode_setLayout,
+        "cocos2d::CCNode::setLayout"
+    );
+    (void) Mod::get()->hook(
+        reinterpret_cast<void*>(addresser::getNonVirtual(
+            static_cast<void(CCNode::*)(std::string const&, CCObject*)>(&CCNode::setUserObject)
+        )),
+        &CCNode_setUserObject,
+        "cocos2d::CCNode::setUserObject"
+    );
+    (void) Mod::get()->hook(
+        reinterpret_cast<void*>(addresser::getNonVirtual(
+            static_cast<void(CCNode::*)(std::string const&, bool)>(&CCNode::setUserFlag)
+        )),
+        &CCNode_setUserFlag,
+        "cocos2d::CCNode::setUserFlag"
+    );
+}
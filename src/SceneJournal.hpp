@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cocos2d.h>
+
+enum class SceneChangeType : uint8_t {
+    AddChild,
+    RemoveChild,
+    RemoveAllChildren,
+    Reorder,
+    SetID,
+    // only for the user objects and flags DevTools itself reads
+    SetUserObject,
+    SetUserFlag,
+    // only when the value actually changes
+    SetVisible,
+    SetLayout,
+};
+
+// Who wants the journal filled, recording goes on as long as anyone does
+enum class SceneJournalReader : uint8_t {
+    Overlay = 1 << 0,
+    Server  = 1 << 1,
+};
+
+// The pointers are only meant to be compared against nodes the reader knows are alive,
+// by the time an entry is read the node may well have been freed
+struct SceneChange {
+    SceneChangeType type;
+    cocos2d::CCNode* node;
+    cocos2d::CCNode* parent;
+};
+
+// Ring buffer of scene graph changes, filled by hooks on CCNode while DevTools is open.
+// Readers remember the generation they last looked at and replay what changed since,
+// instead of walking the whole scene again to find out.
+class SceneJournal {
+public:
+    static constexpr size_t CAPACITY = 4096;
+
+protected:
+    std::array<SceneChange, CAPACITY> m_entries;
+    uint64_t m_generation = 0;
+    uint64_t m_validFrom = 0;
+    uint8_t m_readers = 0;
+
+public:
+    static SceneJournal* get();
+
+    void record(SceneChangeType type, cocos2d::CCNode* node, cocos2d::CCNode* parent);
+    uint64_t generation() const;
+
+    // Forgets everything recorded so far, readers will have to start over
+    void reset();
+    bool isRecording() const;
+    void setRecording(SceneJournalReader reader, bool recording);
+
+    // Calls `fn` for every change recorded after `since`.
+    // Returns false if some of those changes were already dropped, in which case the
+    // reader has to rebuild from scratch.
+    template <class F>
+    bool forEachSince(uint64_t since, F&& fn) const {
+        auto oldest = m_generation > CAPACITY ? m_generation - CAPACITY : 0;
+        if (since < m_validFrom || since < oldest) {
+            return false;
+        }
+        for (auto i = since; i < m_generation; i++) {
+            fn(m_entries[i % CAPACITY]);
+        }
+        return true;
+    }
+};
@@ -0,0 +1,134 @@
+#include "SearchWorker.hpp"
+#include <thread>
+#include <utility>
+
+void SceneSnapshot::add(cocos2d::CCNode* node, uint64_t identity, size_t parent, std::string_view className, std::string_view id, int tag, bool visible, size_t childCount) {
+    nodes.push_back({
+        .node = node,
+        .identity = identity,
+        .parent = parent,
+        .className = className,
+        .idOffset = ids.size(),
+        .idLength = id.size(),
+        .tag = tag,
+        .visible = visible,
+        .childCount = childCount,
+    });
+    ids.append(id);
+}
+
+std::string_view SceneSnapshot::getID(Node const& node) const {
+    return std::string_view(ids).substr(node.idOffset, node.idLength);
+}
+
+void SceneSnapshot::clear() {
+    nodes.clear();
+    ids.clear();
+}
+
+SearchWorker* SearchWorker::get() {
+    static auto inst = new SearchWorker();
+    return inst;
+}
+
+uint64_t SearchWorker::submit(NodeQuery query, SceneSnapshot snapshot) {
+    std::lock_guard lock(m_mutex);
+    if (!m_started) {
+        m_started = true;
+        std::thread(&SearchWorker::run, this).detach();
+    }
+    auto request = ++m_latest;
+    m_pending = Job {
+        .request = request,
+        .query = std::move(query),
+        .snapshot = std::move(snapshot),
+    };
+    m_finished.reset();
+    m_wake.notify_one();
+    return request;
+}
+
+void SearchWorker::cancel() {
+    std::lock_guard lock(m_mutex);
+    ++m_latest;
+    m_pending.reset();
+    m_finished.reset();
+}
+
+std::optional<SearchResult> SearchWorker::poll(uint64_t request) {
+    std::lock_guard lock(m_mutex);
+    if (!m_finished || m_finished->request != request) {
+        return std::nullopt;
+    }
+    return std::exchange(m_finished, std::nullopt);
+}
+
+void SearchWorker::run() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock lock(m_mutex);
+            m_wake.wait(lock, [this] { return m_pending.has_value(); });
+            job = std::move(*m_pending);
+            m_pending.reset();
+        }
+
+        SearchResult result;
+        if (!this->search(job, result)) {
+            continue;
+        }
+
+        std::lock_guard lock(m_mutex);
+        if (result.request == m_latest) {
+            m_finished = std::move(result);
+        }
+    }
+}
+
+// how many nodes to match between checks for a newer request
+static constexpr size_t CANCEL_CHECK_INTERVAL = 1024;
+
+bool SearchWorker::search(Job& job, SearchResult& result) {
+    auto& nodes = job.snapshot.nodes;
+    result.request = job.request;
+    result.subtreeMatched.assign(nodes.size(), false);
+
+    // nodes come parent first, so the path to the current node is a stack
+    std::vector<NodeQueryInput> path;
+    std::vector<size_t> pathIndices;
+    for (size_t i = 0; i < nodes.size(); i++) {
+        if (i % CANCEL_CHECK_INTERVAL == 0 && job.request != m_latest) {
+            return false;
+        }
+
+        auto& node = nodes[i];
+        while (!pathIndices.empty() && pathIndices.back() != node.parent) {
+            pathIndices.pop_back();
+            path.pop_back();
+        }
+        pathIndices.push_back(i);
+        path.push_back({
+            .className = node.className,
+            .id = job.snapshot.getID(node),
+            .tag = node.tag,
+            .visible = node.visible,
+            .childCount = node.childCount,
+        });
+
+        if (job.query.matches(path)) {
+            result.subtreeMatched[i] = true;
+            result.matches.push_back(i);
+        }
+    }
+
+    // children come after their parents, so going backwards settles every subtree before its root
+    for (size_t i = nodes.size(); i-- > 0;) {
+        auto parent = nodes[i].parent;
+        if (result.subtreeMatched[i] && parent != SceneSnapshot::NO_PARENT) {
+            result.subtreeMatched[parent] = true;
+        }
+    }
+
+    result.snapshot = std::move(job.snapshot);
+    return true;
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "NodeQuery.hpp"
+
+// only handled as opaque pointers, so this compiles without the cocos headers
+namespace cocos2d {
+    class CCNode;
+}
+
+// Copy of everything a search looks at, taken on the main thread so the
+// matching itself can run anywhere
+struct SceneSnapshot {
+    static constexpr size_t NO_PARENT = static_cast<size_t>(-1);
+
+    struct Node {
+        // only used to find the node again on the main thread, never dereferenced elsewhere
+        cocos2d::CCNode* node;
+        uint64_t identity;
+        size_t parent;
+        // points into the class name cache, which never frees its entries
+        std::string_view className;
+        size_t idOffset;
+        size_t idLength;
+        int tag;
+        bool visible;
+        size_t childCount;
+    };
+
+    // in depth-first order, so every parent comes before its children
+    std::vector<Node> nodes;
+    // all IDs back to back, to avoid an allocation per node
+    std::string ids;
+
+    void add(cocos2d::CCNode* node, uint64_t identity, size_t parent, std::string_view className, std::string_view id, int tag, bool visible, size_t childCount);
+    std::string_view getID(Node const& node) const;
+    void clear();
+};
+
+struct SearchResult {
+    uint64_t request;
+    SceneSnapshot snapshot;
+    // per snapshot node, whether anything in its subtree matched
+    std::vector<bool> subtreeMatched;
+    // snapshot indices of the matched nodes, in tree order
+    std::vector<size_t> matches;
+};
+
+// Runs Tree searches on a background thread. Only the latest request counts,
+// submitting a new one cancels whatever was still running.
+class SearchWorker {
+protected:
+    struct Job {
+        uint64_t request;
+        NodeQuery query;
+        SceneSnapshot snapshot;
+    };
+
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::optional<Job> m_pending;
+    std::optional<SearchResult> m_finished;
+    std::atomic<uint64_t> m_latest = 0;
+    bool m_started = false;
+
+    void run();
+    bool search(Job& job, SearchResult& result);
+
+public:
+    static SearchWorker* get();
+
+    // Queues a search and returns its request number
+    uint64_t submit(NodeQuery query, SceneSnapshot snapshot);
+    void cancel();
+    // The result of `request` if it is done
+    std::optional<SearchResult> poll(uint64_t request);
+};
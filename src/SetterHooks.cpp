@@ -0,0 +1,154 @@
+#include "SetterHooks.hpp"
+#include "InspectionServer.hpp"
+#include <Geode/modify/CCNode.hpp>
+#include <Geode/modify/CCSprite.hpp>
+#include <vector>
+
+using namespace geode::prelude;
+
+namespace {
+    std::vector<Hook*> s_hooks;
+
+    template <class Self>
+    void registerHooks(Self& self) {
+        for (auto& [name, hook] : self.m_hooks) {
+            hook->setAutoEnable(false);
+            s_hooks.push_back(hook.get());
+        }
+    }
+}
+
+SetterHooks* SetterHooks::get() {
+    static auto inst = new SetterHooks();
+    return inst;
+}
+
+void SetterHooks::setEnabled(SetterHookUser user, bool enabled) {
+    auto wasEnabled = m_users != 0;
+    if (enabled) {
+        m_users |= static_cast<uint8_t>(user);
+    }
+    else {
+        m_users &= ~static_cast<uint8_t>(user);
+    }
+    if (wasEnabled == (m_users != 0)) return;
+    for (auto hook : s_hooks) {
+        (void) (m_users ? hook->enable() : hook->disable());
+    }
+}
+
+bool SetterHooks::isEnabled(SetterHookUser user) const {
+    return m_users & static_cast<uint8_t>(user);
+}
+
+void SetterHooks::beginCount() {
+    m_counting = true;
+    m_count = 0;
+}
+
+size_t SetterHooks::endCount() {
+    m_counting = false;
+    return m_count;
+}
+
+void SetterHooks::setterCalled(CCNode* node) {
+    if (m_counting) {
+        m_count += 1;
+    }
+    if (m_users & static_cast<uint8_t>(SetterHookUser::Server)) {
+        InspectionServer::get()->propertiesChanged(node);
+    }
+}
+
+class $modify(SetterHooksNode, CCNode) {
+    static void onModify(auto& self) {
+        registerHooks(self);
+    }
+
+    void setPosition(CCPoint const& position) override {
+        CCNode::setPosition(position);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setScale(float scale) override {
+        CCNode::setScale(scale);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setScaleX(float scale) override {
+        CCNode::setScaleX(scale);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setScaleY(float scale) override {
+        CCNode::setScaleY(scale);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setRotation(float rotation) override {
+        CCNode::setRotation(rotation);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setRotationX(float rotation) override {
+        CCNode::setRotationX(rotation);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setRotationY(float rotation) override {
+        CCNode::setRotationY(rotation);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setSkewX(float skew) override {
+        CCNode::setSkewX(skew);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setSkewY(float skew) override {
+        CCNode::setSkewY(skew);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setVisible(bool visible) override {
+        CCNode::setVisible(visible);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setContentSize(CCSize const& size) override {
+        CCNode::setContentSize(size);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setAnchorPoint(CCPoint const& point) override {
+        CCNode::setAnchorPoint(point);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setZOrder(int zOrder) override {
+        CCNode::setZOrder(zOrder);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setTag(int tag) override {
+        CCNode::setTag(tag);
+        SetterHooks::get()->setterCalled(this);
+    }
+};
+
+// colour and opacity are only settable on the RGBA nodes, sprites are most of them
+class $modify(SetterHooksSprite, CCSprite) {
+    static void onModify(auto& self) {
+        registerHooks(self);
+    }
+
+    void setOpacity(GLubyte opacity) override {
+        CCSprite::setOpacity(opacity);
+        SetterHooks::get()->setterCalled(this);
+    }
+
+    void setColor(ccColor3B const& color) override {
+        CCSprite::setColor(color);
+        SetterHooks::get()->setterCalled(this);
+    }
+};
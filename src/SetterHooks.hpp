@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cocos2d.h>
+
+// Who wants the setter hooks on, they stay on as long as anyone does
+enum class SetterHookUser : uint8_t {
+    Server     = 1 << 0,
+    Attributes = 1 << 1,
+};
+
+// Hooks on the node property setters, shared by the inspection server (to send out what
+// changed) and the Attributes page (to count the setters it calls). The setters are called
+// a lot, so the hooks are disabled unless somebody needs them.
+class SetterHooks {
+protected:
+    uint8_t m_users = 0;
+    bool m_counting = false;
+    size_t m_count = 0;
+
+public:
+    static SetterHooks* get();
+
+    void setEnabled(SetterHookUser user, bool enabled);
+    bool isEnabled(SetterHookUser user) const;
+
+    // Counts every hooked setter called until endCount, on any node
+    void beginCount();
+    size_t endCount();
+
+    // Called by the hooks
+    void setterCalled(cocos2d::CCNode* node);
+};
@@ -94,6 +94,7 @@
 #define FEATHER_NAVIGATION           u8"\ue94c"
 #define FEATHER_PACKAGE              u8"\ue978"
 #define FEATHER_PAPERCLIP            u8"\ue94d"
+#define FEATHER_PAUSE                u8"\ue97f"
 #define FEATHER_PLAY                 u8"\ue94e"
 #define FEATHER_PLUS                 u8"\ue94f"
 #define FEATHER_PLUS_CIRCLE          u8"\ue950"
@@ -137,26 +138,26 @@
 
 static unsigned char Font_FeatherIcons[] = {
 0x00, 0x01, 0x00, 0x00, 0x00, 0x0B, 0x00, 0x80, 0x00, 0x03, 0x00, 0x30, 0x4F, 0x53, 0x2F, 0x32, 
-0x0F, 0x12, 0x06, 0xA4, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6D, 0x61, 0x70, 
-0x17, 0x56, 0xD3, 0x05, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x54, 0x67, 0x61, 0x73, 0x70, 
+0x0F, 0x12, 0x06, 0xA5, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6D, 0x61, 0x70, 
+0x17, 0x56, 0xD3, 0x06, 0x00, 0x00, 0x01, 0x1C, 0x00, 0x00, 0x00, 0x54, 0x67, 0x61, 0x73, 0x70, 
 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6C, 0x79, 0x66, 
-0xC7, 0xD1, 0x0E, 0x6F, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x7A, 0xA8, 0x68, 0x65, 0x61, 0x64, 
-0x1E, 0x87, 0x55, 0xED, 0x00, 0x00, 0x7C, 0x20, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 
-0x07, 0xC2, 0x04, 0x44, 0x00, 0x00, 0x7C, 0x58, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78, 
-0x02, 0x00, 0x30, 0x17, 0x00, 0x00, 0x7C, 0x7C, 0x00, 0x00, 0x02, 0x0C, 0x6C, 0x6F, 0x63, 0x61, 
-0x0E, 0x6B, 0x2A, 0xC4, 0x00, 0x00, 0x7E, 0x88, 0x00, 0x00, 0x01, 0x08, 0x6D, 0x61, 0x78, 0x70, 
-0x00, 0x8E, 0x02, 0x06, 0x00, 0x00, 0x7F, 0x90, 0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 
-0x99, 0x4A, 0x09, 0xFB, 0x00, 0x00, 0x7F, 0xB0, 0x00, 0x00, 0x01, 0x86, 0x70, 0x6F, 0x73, 0x74, 
-0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x81, 0x38, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x03, 0xFC, 
+0xD4, 0x67, 0x18, 0x9B, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0x7B, 0x5C, 0x68, 0x65, 0x61, 0x64, 
+0x1E, 0x87, 0x55, 0xED, 0x00, 0x00, 0x7C, 0xD4, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, 
+0x07, 0xC2, 0x04, 0x45, 0x00, 0x00, 0x7D, 0x0C, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6D, 0x74, 0x78, 
+0x06, 0x00, 0x30, 0xEC, 0x00, 0x00, 0x7D, 0x30, 0x00, 0x00, 0x02, 0x10, 0x6C, 0x6F, 0x63, 0x61, 
+0x4C, 0x19, 0x2A, 0xC4, 0x00, 0x00, 0x7F, 0x40, 0x00, 0x00, 0x01, 0x0A, 0x6D, 0x61, 0x78, 0x70, 
+0x00, 0x8F, 0x02, 0x06, 0x00, 0x00, 0x80, 0x4C, 0x00, 0x00, 0x00, 0x20, 0x6E, 0x61, 0x6D, 0x65, 
+0x99, 0x4A, 0x09, 0xFB, 0x00, 0x00, 0x80, 0x6C, 0x00, 0x00, 0x01, 0x86, 0x70, 0x6F, 0x73, 0x74, 
+0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x81, 0xF4, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x03, 0xFC, 
 0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x02, 0x99, 0x02, 0xCC, 0x00, 0x00, 0x00, 0x8F, 0x02, 0x99, 
 0x02, 0xCC, 0x00, 0x00, 0x01, 0xEB, 0x00, 0x33, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE9, 0x7E, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xE9, 0x7F, 
 0x03, 0xC0, 0xFF, 0xC0, 0x00, 0x40, 0x03, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 
 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1C, 
 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0A, 
-0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x20, 0xE9, 0x7E, 0xFF, 0xFD, 0xFF, 0xFF, 
+0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x20, 0xE9, 0x7F, 0xFF, 0xFD, 0xFF, 0xFF, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE9, 0x00, 0xFF, 0xFD, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xE3, 
 0x17, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x01, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x0F, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
@@ -2122,88 +2123,100 @@ static unsigned char Font_FeatherIcons[] = {
 0x23, 0x23, 0x4C, 0x29, 0x29, 0x2B, 0x12, 0x1B, 0x02, 0x17, 0x11, 0x04, 0x02, 0x01, 0xFE, 0xD1, 
 0x12, 0x1F, 0x0B, 0x0C, 0x0D, 0x0D, 0x0C, 0x0B, 0x1F, 0x12, 0x01, 0x2B, 0x11, 0x19, 0x19, 0x11, 
 0xFE, 0xD5, 0x23, 0x3F, 0x17, 0x17, 0x1B, 0x1B, 0x17, 0x17, 0x3F, 0x23, 0x12, 0x19, 0x19, 0x12, 
-0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x9E, 0xED, 0xF5, 0x5F, 0x0F, 0x3C, 0xF5, 
-0x00, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xB4, 0x88, 0xCD, 0x00, 0x00, 0x00, 0x00, 
-0xDD, 0xB4, 0x88, 0xCD, 0x00, 0x00, 0xFF, 0xAB, 0x04, 0x00, 0x03, 0xAB, 0x00, 0x00, 0x00, 0x08, 
-0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x03, 0xC0, 0xFF, 0xC0, 
-0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x1C, 0x04, 0x00, 0x00, 0xB7, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0xB7, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x8D, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x01, 0x62, 
-0x04, 0x00, 0x01, 0x62, 0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x01, 0x0C, 0x04, 0x00, 0x00, 0xE2, 
-0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x01, 0x0D, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00, 0x80, 
-0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 
-0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2C, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x80, 
-0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x62, 
-0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0xAB, 0x04, 0x00, 0x00, 0x57, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x59, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x80, 
-0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0xE2, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x00, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x2B, 
-0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 
-0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x37, 
-0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x14, 
-0x00, 0x1E, 0x00, 0xBC, 0x01, 0x22, 0x01, 0xAA, 0x01, 0xE4, 0x02, 0x8E, 0x02, 0xBC, 0x02, 0xF8, 
-0x03, 0x30, 0x03, 0xDA, 0x04, 0x14, 0x04, 0xBE, 0x04, 0xF6, 0x05, 0xA0, 0x05, 0xCE, 0x06, 0x0C, 
-0x06, 0xBE, 0x06, 0xE4, 0x07, 0x7C, 0x07, 0xF0, 0x08, 0x16, 0x08, 0x3C, 0x08, 0x62, 0x08, 0x88, 
-0x08, 0xCA, 0x09, 0x0A, 0x09, 0x4A, 0x09, 0x8C, 0x0A, 0x0E, 0x0A, 0xA6, 0x0B, 0x32, 0x0B, 0xD4, 
-0x0C, 0x1A, 0x0C, 0x60, 0x0C, 0xAA, 0x0C, 0xF8, 0x0D, 0x42, 0x0D, 0x88, 0x0D, 0xD6, 0x0E, 0x20, 
-0x0E, 0x7C, 0x0E, 0xDC, 0x0F, 0xF2, 0x10, 0x5E, 0x10, 0xF6, 0x11, 0x42, 0x11, 0xCC, 0x12, 0xAC, 
-0x13, 0x84, 0x13, 0xE6, 0x14, 0x5A, 0x14, 0xE0, 0x15, 0x4A, 0x15, 0xAE, 0x16, 0x24, 0x16, 0xAE, 
-0x17, 0x1A, 0x17, 0xC6, 0x18, 0xE6, 0x19, 0x50, 0x1A, 0x2C, 0x1A, 0x86, 0x1B, 0x30, 0x1B, 0xBE, 
-0x1C, 0x5C, 0x1C, 0xC0, 0x1D, 0x74, 0x1D, 0xE6, 0x1E, 0x64, 0x1E, 0xFE, 0x1F, 0x5C, 0x1F, 0x9C, 
-0x20, 0x36, 0x20, 0xA4, 0x20, 0xBE, 0x21, 0x2C, 0x21, 0x98, 0x21, 0xD0, 0x22, 0x5E, 0x22, 0x8C, 
-0x22, 0xBE, 0x23, 0x60, 0x23, 0xE2, 0x24, 0xAA, 0x25, 0x72, 0x26, 0x00, 0x26, 0x5A, 0x26, 0xFE, 
-0x27, 0xA4, 0x28, 0x1A, 0x28, 0xDC, 0x29, 0x3C, 0x2C, 0x04, 0x2C, 0x62, 0x2C, 0xA4, 0x2C, 0xE6, 
-0x2D, 0x80, 0x2D, 0xE8, 0x2E, 0x20, 0x2E, 0xB4, 0x2F, 0x48, 0x2F, 0xF2, 0x30, 0x8A, 0x31, 0x0E, 
-0x31, 0x7C, 0x31, 0xB6, 0x32, 0x12, 0x32, 0x9E, 0x33, 0x04, 0x33, 0x3A, 0x33, 0xE4, 0x34, 0x6C, 
-0x34, 0xE2, 0x35, 0x40, 0x35, 0xA0, 0x36, 0x1C, 0x36, 0xDC, 0x37, 0x22, 0x37, 0xB6, 0x38, 0x40, 
-0x38, 0xE6, 0x39, 0x92, 0x3A, 0x9E, 0x3B, 0x12, 0x3B, 0x6A, 0x3B, 0xD6, 0x3C, 0xC0, 0x3D, 0x54, 
-0x00, 0x01, 0x00, 0x00, 0x00, 0x83, 0x02, 0x04, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 
+0x00, 0x04, 0x00, 0xD5, 0x00, 0x2B, 0x03, 0x2B, 0x03, 0x2B, 0x00, 0x0B, 0x00, 0x0F, 0x00, 0x1B, 
+0x00, 0x1F, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 
+0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 
+0x01, 0x01, 0x01, 0x01, 0x00, 0xD5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2B, 0x00, 0xAB, 0x00, 0x2A, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD6, 0xFF, 0x55, 0xFF, 0xD5, 0x00, 0x56, 0x00, 0x55, 
+0x00, 0x00, 0xFF, 0xAB, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2A, 0x00, 0xAB, 0x00, 0x2B, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xD5, 0xFF, 0x55, 0xFF, 0xD6, 0x00, 0x55, 0x00, 0x55, 
+0x00, 0x00, 0xFF, 0xAB, 0x03, 0x00, 0xFD, 0x55, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x2A, 0x02, 0xAB, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00, 
+0xFD, 0xAB, 0x00, 0x00, 0x02, 0x80, 0xFD, 0x55, 0xFF, 0xD6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x2A, 0x02, 0xAB, 0x00, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xAA, 0x00, 0x00, 
+0xFD, 0xAB, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x14, 0xD2, 0x2B, 
+0x5F, 0x0F, 0x3C, 0xF5, 0x00, 0x0B, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDD, 0xB4, 0x88, 0xCD, 
+0x00, 0x00, 0x00, 0x00, 0xDD, 0xB4, 0x88, 0xCD, 0x00, 0x00, 0xFF, 0xAB, 0x04, 0x00, 0x03, 0xAB, 
+0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+0x03, 0xC0, 0xFF, 0xC0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 
+0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x1C, 0x04, 0x00, 0x00, 0xB7, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0xAB, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0xB7, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x01, 0x00, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0xE2, 
+0x04, 0x00, 0x01, 0x62, 0x04, 0x00, 0x01, 0x62, 0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x01, 0x0C, 
+0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x01, 0x0D, 0x04, 0x00, 0x00, 0x80, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x83, 
+0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x80, 
+0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 
+0x04, 0x00, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x05, 0x04, 0x00, 0x00, 0x05, 
+0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x02, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2C, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x2B, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2D, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 
+0x04, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0xAB, 
+0x04, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0xAB, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x59, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0xAB, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x8D, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 
+0x04, 0x00, 0x00, 0xE2, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 
+0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x00, 
+0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x2B, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x2B, 
+0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x55, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x55, 
+0x04, 0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xD5, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x14, 0x00, 0x1E, 0x00, 0xBC, 0x01, 0x22, 0x01, 0xAA, 
+0x01, 0xE4, 0x02, 0x8E, 0x02, 0xBC, 0x02, 0xF8, 0x03, 0x30, 0x03, 0xDA, 0x04, 0x14, 0x04, 0xBE, 
+0x04, 0xF6, 0x05, 0xA0, 0x05, 0xCE, 0x06, 0x0C, 0x06, 0xBE, 0x06, 0xE4, 0x07, 0x7C, 0x07, 0xF0, 
+0x08, 0x16, 0x08, 0x3C, 0x08, 0x62, 0x08, 0x88, 0x08, 0xCA, 0x09, 0x0A, 0x09, 0x4A, 0x09, 0x8C, 
+0x0A, 0x0E, 0x0A, 0xA6, 0x0B, 0x32, 0x0B, 0xD4, 0x0C, 0x1A, 0x0C, 0x60, 0x0C, 0xAA, 0x0C, 0xF8, 
+0x0D, 0x42, 0x0D, 0x88, 0x0D, 0xD6, 0x0E, 0x20, 0x0E, 0x7C, 0x0E, 0xDC, 0x0F, 0xF2, 0x10, 0x5E, 
+0x10, 0xF6, 0x11, 0x42, 0x11, 0xCC, 0x12, 0xAC, 0x13, 0x84, 0x13, 0xE6, 0x14, 0x5A, 0x14, 0xE0, 
+0x15, 0x4A, 0x15, 0xAE, 0x16, 0x24, 0x16, 0xAE, 0x17, 0x1A, 0x17, 0xC6, 0x18, 0xE6, 0x19, 0x50, 
+0x1A, 0x2C, 0x1A, 0x86, 0x1B, 0x30, 0x1B, 0xBE, 0x1C, 0x5C, 0x1C, 0xC0, 0x1D, 0x74, 0x1D, 0xE6, 
+0x1E, 0x64, 0x1E, 0xFE, 0x1F, 0x5C, 0x1F, 0x9C, 0x20, 0x36, 0x20, 0xA4, 0x20, 0xBE, 0x21, 0x2C, 
+0x21, 0x98, 0x21, 0xD0, 0x22, 0x5E, 0x22, 0x8C, 0x22, 0xBE, 0x23, 0x60, 0x23, 0xE2, 0x24, 0xAA, 
+0x25, 0x72, 0x26, 0x00, 0x26, 0x5A, 0x26, 0xFE, 0x27, 0xA4, 0x28, 0x1A, 0x28, 0xDC, 0x29, 0x3C, 
+0x2C, 0x04, 0x2C, 0x62, 0x2C, 0xA4, 0x2C, 0xE6, 0x2D, 0x80, 0x2D, 0xE8, 0x2E, 0x20, 0x2E, 0xB4, 
+0x2F, 0x48, 0x2F, 0xF2, 0x30, 0x8A, 0x31, 0x0E, 0x31, 0x7C, 0x31, 0xB6, 0x32, 0x12, 0x32, 0x9E, 
+0x33, 0x04, 0x33, 0x3A, 0x33, 0xE4, 0x34, 0x6C, 0x34, 0xE2, 0x35, 0x40, 0x35, 0xA0, 0x36, 0x1C, 
+0x36, 0xDC, 0x37, 0x22, 0x37, 0xB6, 0x38, 0x40, 0x38, 0xE6, 0x39, 0x92, 0x3A, 0x9E, 0x3B, 0x12, 
+0x3B, 0x6A, 0x3B, 0xD6, 0x3C, 0xC0, 0x3D, 0x54, 0x3D, 0xAE, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 
+0x00, 0x84, 0x02, 0x04, 0x00, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 
+0x00, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x60, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x03, 0x00, 0x07, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x07, 
+0x00, 0x75, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 0x00, 0x15, 0x00, 0x01, 
+0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x4B, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
+0x00, 0x0A, 0x00, 0x1A, 0x00, 0x8A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x0E, 
+0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E, 0x00, 0x67, 0x00, 0x03, 
+0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x0E, 0x00, 0x3D, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 
+0x00, 0x04, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x16, 
+0x00, 0x20, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x52, 0x00, 0x03, 
+0x00, 0x01, 0x04, 0x09, 0x00, 0x0A, 0x00, 0x34, 0x00, 0xA4, 0x69, 0x63, 0x6F, 0x6D, 0x6F, 0x6F, 
+0x6E, 0x00, 0x69, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6E, 0x56, 
+0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x2E, 0x30, 0x00, 0x56, 0x00, 0x65, 0x00, 0x72, 
+0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 0x00, 0x2E, 0x00, 0x30, 
+0x69, 0x63, 0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 0x00, 0x69, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 
+0x6F, 0x00, 0x6F, 0x00, 0x6E, 0x69, 0x63, 0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 0x00, 0x69, 0x00, 0x63, 
+0x00, 0x6F, 0x00, 0x6D, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6E, 0x52, 0x65, 0x67, 0x75, 0x6C, 0x61, 
+0x72, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 0x61, 0x00, 0x72, 0x69, 
+0x63, 0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 0x00, 0x69, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x6F, 
+0x00, 0x6F, 0x00, 0x6E, 0x46, 0x6F, 0x6E, 0x74, 0x20, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 
+0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x49, 0x63, 0x6F, 0x4D, 0x6F, 0x6F, 0x6E, 0x2E, 0x00, 0x46, 
+0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x67, 0x00, 0x65, 0x00, 0x6E, 0x00, 0x65, 
+0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 0x00, 0x62, 0x00, 0x79, 
+0x00, 0x20, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x4D, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6E, 
+0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x0E, 0x00, 0xAE, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x60, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x07, 0x00, 0x36, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x04, 0x00, 0x07, 0x00, 0x75, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0B, 
-0x00, 0x15, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x4B, 0x00, 0x01, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x1A, 0x00, 0x8A, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 
-0x00, 0x01, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0E, 
-0x00, 0x67, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x0E, 0x00, 0x3D, 0x00, 0x03, 
-0x00, 0x01, 0x04, 0x09, 0x00, 0x04, 0x00, 0x0E, 0x00, 0x7C, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 
-0x00, 0x05, 0x00, 0x16, 0x00, 0x20, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x0E, 
-0x00, 0x52, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0A, 0x00, 0x34, 0x00, 0xA4, 0x69, 0x63, 
-0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 0x00, 0x69, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x6F, 0x00, 
-0x6F, 0x00, 0x6E, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x31, 0x2E, 0x30, 0x00, 0x56, 
-0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x20, 0x00, 0x31, 
-0x00, 0x2E, 0x00, 0x30, 0x69, 0x63, 0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 0x00, 0x69, 0x00, 0x63, 0x00, 
-0x6F, 0x00, 0x6D, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6E, 0x69, 0x63, 0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 
-0x00, 0x69, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x6D, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6E, 0x52, 0x65, 
-0x67, 0x75, 0x6C, 0x61, 0x72, 0x00, 0x52, 0x00, 0x65, 0x00, 0x67, 0x00, 0x75, 0x00, 0x6C, 0x00, 
-0x61, 0x00, 0x72, 0x69, 0x63, 0x6F, 0x6D, 0x6F, 0x6F, 0x6E, 0x00, 0x69, 0x00, 0x63, 0x00, 0x6F, 
-0x00, 0x6D, 0x00, 0x6F, 0x00, 0x6F, 0x00, 0x6E, 0x46, 0x6F, 0x6E, 0x74, 0x20, 0x67, 0x65, 0x6E, 
-0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x49, 0x63, 0x6F, 0x4D, 0x6F, 0x6F, 
-0x6E, 0x2E, 0x00, 0x46, 0x00, 0x6F, 0x00, 0x6E, 0x00, 0x74, 0x00, 0x20, 0x00, 0x67, 0x00, 0x65, 
-0x00, 0x6E, 0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, 0x20, 
-0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6F, 0x00, 0x4D, 0x00, 0x6F, 
-0x00, 0x6F, 0x00, 0x6E, 0x00, 0x2E, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+0x00, 0x00, 0x00, 0x00
 };
@@ -5,6 +5,7 @@
 #include <Geode/modify/CCNode.hpp>
 #include <Geode/modify/GameToolbox.hpp>
 #include "DevTools.hpp"
+#include "InspectionServer.hpp"
 #include <imgui.h>
 #include "ImGui.hpp"
 #include "nodes/DragButton.hpp"
@@ -23,6 +24,7 @@ class $modify(CCNode) {
 $execute {
     GameEvent(GameEventType::Loaded).listen([] {
         if (DevTools::get()->isButtonEnabled()) DevTools::get()->setupDragButton();
+        InspectionServer::get()->setEnabled(DevTools::get()->getSettings().inspectionServer);
     }).leak();
 
     listenForKeybindSettingPresses("open-bind", [](Keybind const& keybind, bool down, bool repeat, double timestamp) {
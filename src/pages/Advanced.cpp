@@ -6,8 +6,28 @@
 using namespace geode::prelude;
 
 void DevTools::drawAdvancedSettings() {
-    ImGui::PushStyleVar(ImGuiStyleVar_FramePadding, { 1.f, 1.f });
-    ImGui::PopStyleVar();
+    if (ImGui::CollapsingHeader("Render", ImGuiTreeNodeFlags_DefaultOpen)) {
+        auto const& stats = m_renderer.lastStats();
+        ImGui::Text("Draw calls: %zu", stats.drawCalls);
+        ImGui::Text("Texture binds: %zu", stats.textureBinds);
+        ImGui::Text("Scissor changes: %zu", stats.scissorChanges);
+        ImGui::Text("Buffer allocations: %zu", stats.bufferAllocations);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Should stay at 0 once the UI stops growing");
+        }
+        ImGui::Text("Buffer orphans: %zu", stats.bufferOrphans);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Fresh buffer storage requested each frame so the GPU never has to be waited on");
+        }
+        ImGui::Text("Uploaded: %.1f KiB", stats.bytesUploaded / 1024.0);
+        ImGui::Text("Vertices: %zu, indices: %zu", stats.vertices, stats.indices);
+    }
+    if (ImGui::CollapsingHeader("Attributes", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Text("Setter calls: %zu", m_attributeSetterCalls);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("Node setters called while the Attributes page is drawn, custom attributes\nincluded. Shouldn't go up unless something is being edited.");
+        }
+    }
 }
 
 void DevTools::drawModGraph() {
@@ -4,6 +4,8 @@
 #include <misc/cpp/imgui_stdlib.h>
 #include <Geode/binding/CCMenuItemSpriteExtra.hpp>
 #include "../platform/utils.hpp"
+#include "../CacheIndex.hpp"
+#include "../SetterHooks.hpp"
 #include <ccTypes.h>
 #include <Geode/ui/SimpleAxisLayout.hpp>
 #include <Geode/ui/Layout.hpp>
@@ -38,25 +40,50 @@ bool checkbox(const char* text, T* ptr, bool(T::* get)() const, R(T::* set)(bool
     return false;
 }
 
+AttributeDispatch const& DevTools::getAttributeDispatch(CCNode* node) {
+    auto& dispatch = m_attributeDispatch[typeid(*node)];
+    if (!dispatch.computed) {
+        dispatch.color = typeinfo_cast<CCRGBAProtocol*>(node) != nullptr;
+        dispatch.label = typeinfo_cast<CCLabelProtocol*>(node) != nullptr;
+        dispatch.axisGap = typeinfo_cast<AxisGap*>(node) != nullptr;
+        dispatch.texture = typeinfo_cast<geode::NineSlice*>(node) || typeinfo_cast<CCTextureProtocol*>(node);
+        dispatch.menuItem = typeinfo_cast<CCMenuItem*>(node) || typeinfo_cast<geode::Button*>(node);
+        dispatch.computed = true;
+    }
+    // only does anything for a type seen before when mods registered more callbacks since
+    for (; dispatch.callbackCount < m_customCallbacks.size(); dispatch.callbackCount++) {
+        auto matches = m_customCallbacks[dispatch.callbackCount].matches;
+        if (!matches || matches(node)) {
+            dispatch.callbacks.push_back(dispatch.callbackCount);
+        }
+    }
+    return dispatch;
+}
+
 void DevTools::drawNodeAttributes(CCNode* node) {
+    auto const& dispatch = this->getAttributeDispatch(node);
+
     drawBasicAttributes(node);
-    drawColorAttributes(node);
-    drawLabelAttributes(node);
-    drawAxisGapAttribute(node);
+    if (dispatch.color) drawColorAttributes(node);
+    if (dispatch.label) drawLabelAttributes(node);
+    if (dispatch.axisGap) drawAxisGapAttribute(node);
 
     ImGui::NewLine();
     ImGui::Separator();
     ImGui::NewLine();
 
-    drawTextureAttributes(node);
-    drawMenuItemAttributes(node);
+    if (dispatch.texture) drawTextureAttributes(node);
+    if (dispatch.menuItem) drawMenuItemAttributes(node);
 
     setUsedAPI(false);
-    for (auto& callback : m_customCallbacks) {
+    m_attributesNode = node;
+    for (auto index : dispatch.callbacks) {
+        auto& callback = m_customCallbacks[index];
         ImGui::PushID(&callback);
-        callback(node);
+        callback.callback(node);
         ImGui::PopID();
     }
+    m_attributesNode = nullptr;
 
     // fixes that extra separator for nodes that the API isn't used on
     if (usedAPI()) {
@@ -72,6 +99,15 @@ void DevTools::drawNodeAttributes(CCNode* node) {
     ImGui::NewLine();
 
     drawLayoutAttributes(node);
+
+    // statistics are cached for one subtree only, which is the selected one
+    if (node == m_selectedNode) {
+        ImGui::NewLine();
+        ImGui::Separator();
+        ImGui::NewLine();
+
+        drawStatisticsAttributes(node);
+    }
 }
 
 void DevTools::drawBasicAttributes(CCNode* node) {
@@ -136,55 +172,80 @@ void DevTools::drawBasicAttributes(CCNode* node) {
         ImGui::Text("Node ID: N/A");
     }
 
+    // only write back what was actually edited, setters mark the transform dirty and
+    // some of them trigger layouts
     float pos[2] = {
         node->getPositionX(),
         node->getPositionY()
     };
-    ImGui::DragFloat2("Position", pos);
-    node->setPosition(pos[0], pos[1]);
+    if (ImGui::DragFloat2("Position", pos)) {
+        auto before = EditJournal::capture(node, EditProperty::Position);
+        node->setPosition(pos[0], pos[1]);
+        this->recordEdit(node, EditProperty::Position, before);
+    }
+    this->drawWatchMenu(node, { WatchKind::PositionX, WatchKind::PositionY });
 
     float scale[3] = { node->getScale(), node->getScaleX(), node->getScaleY() };
-    ImGui::DragFloat3("Scale", scale, 0.025f);
-    if (node->getScale() != scale[0]) {
-        node->setScale(scale[0]);
-    } else {
-        node->setScaleX(scale[1]);
-        node->setScaleY(scale[2]);
+    if (ImGui::DragFloat3("Scale", scale, 0.025f)) {
+        auto before = EditJournal::capture(node, EditProperty::Scale);
+        if (node->getScale() != scale[0]) {
+            node->setScale(scale[0]);
+        } else {
+            node->setScaleX(scale[1]);
+            node->setScaleY(scale[2]);
+        }
+        this->recordEdit(node, EditProperty::Scale, before);
     }
+    this->drawWatchMenu(node, { WatchKind::ScaleX, WatchKind::ScaleY });
 
     float rot[3] = { node->getRotation(), node->getRotationX(), node->getRotationY() };
-    ImGui::DragFloat3("Rotation", rot);
-    if (node->getRotation() != rot[0]) {
-        node->setRotation(rot[0]);
-    } else {
-        node->setRotationX(rot[1]);
-        node->setRotationY(rot[2]);
+    if (ImGui::DragFloat3("Rotation", rot)) {
+        auto before = EditJournal::capture(node, EditProperty::Rotation);
+        if (node->getRotation() != rot[0]) {
+            node->setRotation(rot[0]);
+        } else {
+            node->setRotationX(rot[1]);
+            node->setRotationY(rot[2]);
+        }
+        this->recordEdit(node, EditProperty::Rotation, before);
     }
+    this->drawWatchMenu(node, { WatchKind::Rotation });
 
     float _skew[2] = { node->getSkewX(), node->getSkewY() };
-    ImGui::DragFloat2("Skew", _skew);
-    node->setSkewX(_skew[0]);
-    node->setSkewY(_skew[1]);
+    if (ImGui::DragFloat2("Skew", _skew)) {
+        auto before = EditJournal::capture(node, EditProperty::Skew);
+        node->setSkewX(_skew[0]);
+        node->setSkewY(_skew[1]);
+        this->recordEdit(node, EditProperty::Skew, before);
+    }
 
     auto anchor = node->getAnchorPoint();
-    ImGui::DragFloat2("Anchor Point", &anchor.x, 0.05f, 0.f, 1.f);
-    node->setAnchorPoint(anchor);
+    if (ImGui::DragFloat2("Anchor Point", &anchor.x, 0.05f, 0.f, 1.f)) {
+        auto before = EditJournal::capture(node, EditProperty::AnchorPoint);
+        node->setAnchorPoint(anchor);
+        this->recordEdit(node, EditProperty::AnchorPoint, before);
+    }
 
     auto contentSize = node->getContentSize();
-    ImGui::DragFloat2("Content Size", &contentSize.width);
-    if (contentSize != node->getContentSize()) {
+    if (ImGui::DragFloat2("Content Size", &contentSize.width)) {
+        auto before = EditJournal::capture(node, EditProperty::ContentSize);
         node->setContentSize(contentSize);
         node->updateLayout();
+        this->recordEdit(node, EditProperty::ContentSize, before);
     }
+    this->drawWatchMenu(node, { WatchKind::Width, WatchKind::Height });
 
     int zOrder = node->getZOrder();
-    ImGui::InputInt("Z Order", &zOrder);
-    if (node->getZOrder() != zOrder) {
+    if (ImGui::InputInt("Z Order", &zOrder)) {
+        auto before = EditJournal::capture(node, EditProperty::ZOrder);
         node->setZOrder(zOrder);
+        this->recordEdit(node, EditProperty::ZOrder, before);
     }
     int tag = node->getTag();
     if (ImGui::InputInt("Tag", &tag)) {
+        auto before = EditJournal::capture(node, EditProperty::Tag);
         node->setTag(tag);
+        this->recordEdit(node, EditProperty::Tag, before);
     }
 
     if (auto delegate = typeinfo_cast<CCTouchDelegate*>(node)) {
@@ -203,7 +264,12 @@ void DevTools::drawBasicAttributes(CCNode* node) {
         checkbox("Flip Y", sprite, &CCSprite::isFlipY, &CCSprite::setFlipY);
     }
     
-    checkbox("Visible", node, &CCNode::isVisible, &CCNode::setVisible);
+    bool visible = node->isVisible();
+    if (ImGui::Checkbox("Visible", &visible)) {
+        auto before = EditJournal::capture(node, EditProperty::Visible);
+        node->setVisible(visible);
+        this->recordEdit(node, EditProperty::Visible, before);
+    }
     checkbox(
         "Ignore Anchor Point for Position",
         node,
@@ -298,16 +364,11 @@ void DevTools::drawTextureAttributes(CCNode* node) {
     if (auto textureProtocol = typeinfo_cast<CCTextureProtocol*>(node)) {
         if (auto texture = textureProtocol->getTexture()) {
             if (auto spriteNode = typeinfo_cast<CCSprite*>(node)) {
-                auto* cachedFrames = CCSpriteFrameCache::sharedSpriteFrameCache()->m_pSpriteFrames;
-                const auto rect = spriteNode->getTextureRect();
-                for (auto [key, frame] : CCDictionaryExt<std::string, CCSpriteFrame*>(cachedFrames)) {
-                    if (frame->getTexture() == texture && frame->getRect() == rect) {
-                        ImGui::Text("Frame name: %s", key.c_str());
-                        ImGui::SameLine();
-                        if (ImGui::Button(U8STR(FEATHER_COPY " Copy##copysprframename"))) {
-                            clipboard::write(key);
-                        }
-                        break;
+                if (auto name = SpriteFrameIndex::get()->find(texture, spriteNode->getTextureRect())) {
+                    ImGui::Text("Frame name: %s", name->c_str());
+                    ImGui::SameLine();
+                    if (ImGui::Button(U8STR(FEATHER_COPY " Copy##copysprframename"))) {
+                        clipboard::write(*name);
                     }
                 }
                 float textureRect[4] = {
@@ -316,7 +377,7 @@ void DevTools::drawTextureAttributes(CCNode* node) {
                     spriteNode->getTextureRect().size.width,
                     spriteNode->getTextureRect().size.height,
                 };
-                if (ImGui::DragFloat4("Rect", textureRect), 0.03f) {
+                if (ImGui::DragFloat4("Rect", textureRect, 0.03f)) {
                     spriteNode->setTextureRect({textureRect[0], textureRect[1], textureRect[2], textureRect[3]}, spriteNode->isTextureRectRotated(), spriteNode->getContentSize());
                 }
 
@@ -326,20 +387,16 @@ void DevTools::drawTextureAttributes(CCNode* node) {
                 }
                 ImGui::NewLine();
             }
-            auto* cachedTextures = CCTextureCache::sharedTextureCache()->m_pTextures;
-            for (auto [key, obj] : CCDictionaryExt<std::string, CCTexture2D*>(cachedTextures)) {
-                if (obj == texture) {
-                    std::string fileName = std::filesystem::path(key).filename().string();
-                    ImGui::TextWrapped("Texture name: %s", fileName.c_str());
-                    ImGui::TextWrapped("Texture path: %s", key.c_str());
-                    if (ImGui::Button(U8STR(FEATHER_COPY " Copy Texture Name##copytexturename"))) {
-                        clipboard::write(fileName);
-                    }
-                    ImGui::SameLine();
-                    if (ImGui::Button(U8STR(FEATHER_COPY " Copy Texture Path##copytexturepath"))) {
-                        clipboard::write(key);
-                    }
-                    break;
+            if (auto key = TextureIndex::get()->find(texture)) {
+                std::string fileName = std::filesystem::path(*key).filename().string();
+                ImGui::TextWrapped("Texture name: %s", fileName.c_str());
+                ImGui::TextWrapped("Texture path: %s", key->c_str());
+                if (ImGui::Button(U8STR(FEATHER_COPY " Copy Texture Name##copytexturename"))) {
+                    clipboard::write(fileName);
+                }
+                ImGui::SameLine();
+                if (ImGui::Button(U8STR(FEATHER_COPY " Copy Texture Path##copytexturepath"))) {
+                    clipboard::write(*key);
                 }
             }
         }
@@ -716,8 +773,7 @@ void DevTools::drawLayoutOptionsAttributes(CCNode* node) {
             bool updateLayout = false;
 
             auto offset = opts->getOffset();
-            ImGui::DragFloat2("Offset", &offset.x);
-            if (opts->getOffset() != offset) {
+            if (ImGui::DragFloat2("Offset", &offset.x)) {
                 opts->setOffset(offset);
                 updateLayout = true;
             }
@@ -767,6 +823,7 @@ void DevTools::drawLayoutOptionsAttributes(CCNode* node) {
 void DevTools::drawLayoutAttributes(CCNode* node){
     if (auto rawLayout = node->getLayout()) {
         ImGui::Text("Layout: %s", typeid(*rawLayout).name());
+        this->drawLayoutStats(node);
         
         if (ImGui::Button(U8STR(FEATHER_REFRESH_CW " Update Layout"))) {
             node->updateLayout();
@@ -1218,10 +1275,142 @@ void DevTools::drawLayoutAttributes(CCNode* node){
     }
 }
 
+void DevTools::recordEdit(CCNode* node, EditProperty property, EditValue const& before) {
+    // drags report a change every frame, keep them as one edit. Drags only start changing
+    // the value a few frames after being clicked, so the gesture is tracked here instead
+    // of going by IsItemActivated
+    auto item = ImGui::GetItemID();
+    auto merge = ImGui::IsItemActive() && m_editGestureItem == item;
+    m_editGestureItem = ImGui::IsItemActive() ? item : 0;
+    EditJournal::get()->record(node, property, before, EditJournal::capture(node, property), merge);
+}
+
+void DevTools::undoEdit() {
+    EditJournal::get()->undo();
+    this->invalidateTree();
+}
+
+void DevTools::redoEdit() {
+    EditJournal::get()->redo();
+    this->invalidateTree();
+}
+
+void DevTools::drawEditHistory() {
+    auto journal = EditJournal::get();
+    ImGui::BeginDisabled(!journal->canUndo());
+    if (ImGui::Button(U8STR(FEATHER_ROTATE_CCW " Undo"))) {
+        this->undoEdit();
+    }
+    ImGui::EndDisabled();
+    ImGui::SameLine();
+    ImGui::BeginDisabled(!journal->canRedo());
+    if (ImGui::Button(U8STR(FEATHER_ROTATE_CW " Redo"))) {
+        this->redoEdit();
+    }
+    ImGui::EndDisabled();
+    if (ImGui::IsItemHovered(ImGuiHoveredFlags_AllowWhenDisabled)) {
+        ImGui::SetTooltip(
+            "%zu edits to undo, %zu to redo (keeps the last %zu)\nCtrl+Z / Ctrl+Y",
+            journal->undoCount(), journal->redoCount(), EditJournal::CAPACITY
+        );
+    }
+}
+
+template <class F>
+void DevTools::applyBulkEdit(EditProperty property, F&& edit) {
+    auto journal = EditJournal::get();
+    journal->beginGroup();
+    // one layout per parent instead of one per node
+    m_bulkParents.clear();
+    for (auto& node : m_multiSelection) {
+        auto before = EditJournal::capture(node.data(), property);
+        edit(node.data());
+        journal->record(node.data(), property, before, EditJournal::capture(node.data(), property));
+        if (auto parent = node->getParent()) {
+            m_bulkParents.push_back(parent);
+        }
+    }
+    std::sort(m_bulkParents.begin(), m_bulkParents.end());
+    m_bulkParents.erase(std::unique(m_bulkParents.begin(), m_bulkParents.end()), m_bulkParents.end());
+    for (auto parent : m_bulkParents) {
+        parent->updateLayout();
+    }
+    journal->endGroup();
+}
+
+void DevTools::drawBulkAttributes() {
+    ImGui::Text("%zu nodes selected", m_multiSelection.size());
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_X_CIRCLE " Deselect"))) {
+        return this->selectNode(nullptr);
+    }
+
+    ImGui::NewLine();
+    ImGui::Separator();
+    ImGui::NewLine();
+
+    ImGui::DragFloat2("Offset##bulkoffset", &m_bulkOffset.x);
+    ImGui::SameLine();
+    if (ImGui::Button("Move##bulkmove")) {
+        this->applyBulkEdit(EditProperty::Position, [&](CCNode* node) {
+            node->setPosition(node->getPosition() + m_bulkOffset);
+        });
+    }
+
+    ImGui::DragFloat("Scale##bulkscale", &m_bulkScale, 0.025f);
+    ImGui::SameLine();
+    if (ImGui::Button("Apply##bulkscale")) {
+        this->applyBulkEdit(EditProperty::Scale, [&](CCNode* node) {
+            node->setScale(m_bulkScale);
+        });
+    }
+
+    ImGui::SliderInt("Opacity##bulkopacity", &m_bulkOpacity, 0, 255);
+    ImGui::SameLine();
+    if (ImGui::Button("Apply##bulkopacity")) {
+        this->applyBulkEdit(EditProperty::Opacity, [&](CCNode* node) {
+            if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+                rgba->setOpacity(static_cast<GLubyte>(m_bulkOpacity));
+            }
+        });
+    }
+
+    ImGui::InputInt("Z Order##bulkzorder", &m_bulkZOrder);
+    ImGui::SameLine();
+    if (ImGui::Button("Apply##bulkzorder")) {
+        this->applyBulkEdit(EditProperty::ZOrder, [&](CCNode* node) {
+            node->setZOrder(m_bulkZOrder);
+        });
+    }
+
+    if (ImGui::Button(U8STR(FEATHER_EYE " Show All"))) {
+        this->applyBulkEdit(EditProperty::Visible, [](CCNode* node) {
+            node->setVisible(true);
+        });
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_EYE_OFF " Hide All"))) {
+        this->applyBulkEdit(EditProperty::Visible, [](CCNode* node) {
+            node->setVisible(false);
+        });
+    }
+}
+
 void DevTools::drawAttributes() {
-    if (!m_selectedNode) {
+    // everything the page sets goes through the setter hooks, whoever calls it
+    auto setterHooks = SetterHooks::get();
+    setterHooks->beginCount();
+
+    this->drawEditHistory();
+    ImGui::Separator();
+
+    if (m_multiSelection.size() > 1) {
+        this->drawBulkAttributes();
+    } else if (!m_selectedNode) {
         ImGui::TextWrapped("Select a Node to Edit in the Scene or Tree");
     } else {
         this->drawNodeAttributes(m_selectedNode);
     }
+
+    m_attributeSetterCalls += setterHooks->endCount();
 }
@@ -263,6 +263,28 @@ void drawLayoutArrows(
     );
 }
 
+// Maps points in GD world space onto the GD window inside DevTools
+struct GDWindowMapping {
+    ImVec2 scale;
+    ImVec2 origin;
+
+    static GDWindowMapping current() {
+        auto winSize = CCDirector::get()->getWinSize();
+        auto rect = getGDWindowRect();
+        return {
+            ImVec2(rect.GetWidth() / winSize.width, rect.GetHeight() / winSize.height),
+            ImVec2(rect.Min.x, rect.Max.y)
+        };
+    }
+
+    ImVec2 map(CCPoint const& point) const {
+        return ImVec2(
+            origin.x + point.x * scale.x,
+            origin.y - point.y * scale.y
+        );
+    }
+};
+
 void DevTools::drawHighlight(CCNode* node, HighlightMode mode) {
 	auto& foreground = *ImGui::GetWindowDrawList();
 	auto parent = node->getParent();
@@ -285,20 +307,9 @@ void DevTools::drawHighlight(CCNode* node, HighlightMode mode) {
 	}
 #endif
 
-	auto min = toVec2(parent ? parent->convertToWorldSpace(bb_min) : bb_min);
-	auto max = toVec2(parent ? parent->convertToWorldSpace(bb_max) : bb_max);
-
-    auto wsize = ImGui::GetMainViewport()->Size;
-    auto rect = getGDWindowRect();
-
-    auto tmin = ImVec2(
-        min.x / wsize.x * rect.GetWidth() + rect.Min.x,
-        min.y / wsize.y * rect.GetHeight() + rect.Min.y
-    );
-    auto tmax = ImVec2(
-        max.x / wsize.x * rect.GetWidth() + rect.Min.x,
-        max.y / wsize.y * rect.GetHeight() + rect.Min.y
-    );
+	auto mapping = GDWindowMapping::current();
+	auto tmin = mapping.map(parent ? parent->convertToWorldSpace(bb_min) : bb_min);
+	auto tmax = mapping.map(parent ? parent->convertToWorldSpace(bb_max) : bb_max);
 
     if (
         isnan(tmax.x) ||
@@ -377,6 +388,90 @@ void DevTools::drawLayoutHighlights(CCNode* node) {
     #endif
 }
 
+// Past this many boxes the overlay stops drawing, giant editor scenes would otherwise
+// spend more time in ImGui than in the game itself
+static constexpr size_t MAX_BOUNDS_PRIMITIVES = 8192;
+
+void DevTools::drawAllBounds(CCNode* root) {
+    if (!root) return;
+
+    struct BoundsEntry {
+        CCNode* node;
+        CCAffineTransform parentTransform;
+        CCPoint cameraOffset;
+        int depth;
+    };
+
+    auto& foreground = *ImGui::GetWindowDrawList();
+    auto mapping = GDWindowMapping::current();
+    auto clip = getGDWindowRect();
+
+    static std::vector<BoundsEntry> stack;
+    stack.clear();
+    stack.push_back({ root, CCAffineTransformMakeIdentity(), CCPointZero, 0 });
+
+    size_t drawn = 0;
+    size_t culled = 0;
+    size_t skipped = 0;
+
+    while (!stack.empty()) {
+        auto entry = stack.back();
+        stack.pop_back();
+
+        auto node = entry.node;
+        if (!node->isVisible()) continue;
+
+        // accumulate the world transform on the way down instead of having
+        // convertToWorldSpace walk back up to the scene for every node
+        auto transform = CCAffineTransformConcat(node->nodeToParentTransform(), entry.parentTransform);
+        auto cameraOffset = entry.cameraOffset;
+#ifdef GEODE_IS_WINDOWS
+        // same camera correction as drawHighlight, without lazily creating a camera for every node
+        if (auto camera = node->m_pCamera) {
+            float offX, offY, offZ;
+            camera->getEyeXYZ(&offX, &offY, &offZ);
+            cameraOffset = cameraOffset + CCPoint(offX, offY);
+        }
+#endif
+
+        auto size = node->getContentSize();
+        if (size.width > 0.f && size.height > 0.f) {
+            auto box = CCRectApplyAffineTransform(CCRect(0, 0, size.width, size.height), transform);
+            auto tmin = mapping.map(CCPoint(box.getMinX(), box.getMaxY()) - cameraOffset);
+            auto tmax = mapping.map(CCPoint(box.getMaxX(), box.getMinY()) - cameraOffset);
+
+            if (tmax.x < clip.Min.x || tmin.x > clip.Max.x || tmax.y < clip.Min.y || tmin.y > clip.Max.y) {
+                culled += 1;
+            }
+            else if (drawn >= MAX_BOUNDS_PRIMITIVES) {
+                skipped += 1;
+            }
+            else {
+                float hue;
+                if (m_settings.boundsByClass) {
+                    hue = static_cast<float>(typeid(*node).hash_code() % 360) / 360.f;
+                }
+                else {
+                    hue = std::fmod(entry.depth * 0.13f, 1.f);
+                }
+                foreground.AddRect(tmin, tmax, ImColor::HSV(hue, .7f, 1.f, .7f));
+                drawn += 1;
+            }
+        }
+
+        auto children = node->getChildren();
+        if (!children) continue;
+        for (auto child : CCArrayExt<CCNode*>(children)) {
+            stack.push_back({ child, transform, cameraOffset, entry.depth + 1 });
+        }
+    }
+
+    auto text = skipped ?
+        fmt::format("{} bounds drawn, {} culled, {} over limit", drawn, culled, skipped) :
+        fmt::format("{} bounds drawn, {} culled", drawn, culled);
+    foreground.AddText(clip.Min + ImVec2(4.f, 4.f), IM_COL32(255, 255, 255, 255), text.c_str());
+}
+
 void DevTools::drawGD(GLRenderCtx* gdCtx) {
     if (gdCtx) {
         auto winSize = CCDirector::get()->getWinSize();
@@ -422,6 +517,9 @@ void DevTools::drawGD(GLRenderCtx* gdCtx) {
             if (m_settings.highlightLayouts) {
                 this->drawLayoutHighlights(CCDirector::get()->getRunningScene());
             }
+            if (m_settings.showAllBounds) {
+                this->drawAllBounds(CCDirector::get()->getRunningScene());
+            }
 
             for (auto& [node, mode] : m_toHighlight) {
                 this->drawHighlight(node, mode);
@@ -0,0 +1,154 @@
+#include "../fonts/FeatherIcons.hpp"
+#include "../DevTools.hpp"
+#include "../LayoutProfiler.hpp"
+#include "../platform/utils.hpp"
+
+using namespace geode::prelude;
+
+static constexpr ImVec4 EVERY_FRAME_COLOR = ImVec4(1.f, .7f, .2f, 1.f);
+static constexpr ImVec4 CASCADE_COLOR = ImVec4(1.f, .35f, .35f, 1.f);
+
+static constexpr std::array<char const*, 3> HOT_LIST_SORTS = {
+    "Total time",
+    "Calls in a frame",
+    "Cascades",
+};
+
+void DevTools::drawLayoutStats(CCNode* node) {
+    auto profiler = LayoutProfiler::get();
+    if (!profiler->isRecording()) {
+        if (ImGui::Button(U8STR(FEATHER_CLOCK " Profile Layouts"))) {
+            profiler->setRecording(true);
+            m_showLayoutProfiler = true;
+        }
+        return;
+    }
+
+    auto stats = profiler->find(node);
+    if (!stats) {
+        ImGui::TextDisabled("Not laid out since profiling started");
+        return;
+    }
+    ImGui::Text("Layouts: %zu (%.3f ms)", stats->calls, stats->time);
+    ImGui::Text("Last frame laid out: %u times (%.3f ms)", stats->frameCalls, stats->frameTime);
+    if (LayoutProfiler::isEveryFrame(*stats)) {
+        ImGui::TextColored(EVERY_FRAME_COLOR, "Laid out every frame (%u frames in a row)", stats->streak);
+    }
+    if (stats->cascades) {
+        ImGui::TextColored(CASCADE_COLOR, "Made an ancestor lay out again %zu times", stats->cascades);
+    }
+}
+
+void DevTools::drawLayoutProfiler() {
+    auto profiler = LayoutProfiler::get();
+    if (ImGui::Button(U8STR(FEATHER_X " Close"))) {
+        profiler->setRecording(false);
+        profiler->clear();
+        m_showLayoutProfiler = false;
+        return;
+    }
+    ImGui::SameLine();
+    if (profiler->isRecording()) {
+        if (ImGui::Button("Stop")) {
+            profiler->setRecording(false);
+        }
+    }
+    else if (ImGui::Button(U8STR(FEATHER_PLAY " Record"))) {
+        profiler->setRecording(true);
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_TRASH_2 " Clear"))) {
+        profiler->clear();
+    }
+    ImGui::SameLine();
+    ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x);
+    ImGui::Combo("##hotlistsort", &m_layoutHotListSort, HOT_LIST_SORTS.data(), static_cast<int>(HOT_LIST_SORTS.size()));
+
+    profiler->compact();
+    auto& stats = profiler->stats();
+    m_layoutHotList.clear();
+    for (auto& [identity, _] : stats) {
+        m_layoutHotList.push_back(identity);
+    }
+    auto key = [&](uint64_t identity) {
+        auto& entry = stats.at(identity);
+        switch (m_layoutHotListSort) {
+            default: return entry.time;
+            case 1: return static_cast<double>(entry.frameCalls);
+            case 2: return static_cast<double>(entry.cascades);
+        }
+    };
+    std::sort(m_layoutHotList.begin(), m_layoutHotList.end(), [&](uint64_t a, uint64_t b) {
+        return key(a) > key(b);
+    });
+
+    ImGui::Text("%zu nodes laid out", m_layoutHotList.size());
+    ImGui::SameLine();
+    ImGui::TextColored(EVERY_FRAME_COLOR, "every frame");
+    ImGui::SameLine();
+    ImGui::TextColored(CASCADE_COLOR, "re-lays out its parents");
+
+    auto flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+    if (!ImGui::BeginTable("layout-hot-list", 5, flags)) {
+        return;
+    }
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Node");
+    ImGui::TableSetupColumn("Layout");
+    ImGui::TableSetupColumn("Frame", ImGuiTableColumnFlags_WidthFixed);
+    ImGui::TableSetupColumn("Total", ImGuiTableColumnFlags_WidthFixed);
+    ImGui::TableSetupColumn("Cascades", ImGuiTableColumnFlags_WidthFixed);
+    ImGui::TableHeadersRow();
+
+    auto registry = NodeRegistry::get();
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(m_layoutHotList.size()));
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+            auto identity = m_layoutHotList[row];
+            auto& entry = stats.at(identity);
+            auto node = registry->find(identity);
+            if (!node) continue;
+
+            ImGui::PushID(row);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            auto label = fmt::format("{}", getObjectClassName(node));
+            if (!node->getID().empty()) {
+                label += fmt::format(" \"{}\"", node->getID());
+            }
+            auto colored = entry.cascades || LayoutProfiler::isEveryFrame(entry);
+            if (colored) {
+                ImGui::PushStyleColor(ImGuiCol_Text, entry.cascades ? CASCADE_COLOR : EVERY_FRAME_COLOR);
+            }
+            bool clicked = ImGui::Selectable(label.c_str(), node == m_selectedNode.data(), ImGuiSelectableFlags_SpanAllColumns);
+            if (colored) {
+                ImGui::PopStyleColor();
+            }
+
+            ImGui::TableNextColumn();
+            if (auto layout = node->getLayout()) {
+                auto name = getObjectClassName(layout);
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
+            }
+            else {
+                ImGui::TextDisabled("None");
+            }
+
+            ImGui::TableNextColumn();
+            ImGui::Text("%ux %.3f ms", entry.frameCalls, entry.frameTime);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zux %.3f ms", entry.calls, entry.time);
+            ImGui::TableNextColumn();
+            ImGui::Text("%zu", entry.cascades);
+            ImGui::PopID();
+
+            if (clicked) {
+                this->selectNode(node);
+                this->expandToNode(node);
+                m_scrollToNode = node;
+            }
+        }
+    }
+    ImGui::EndTable();
+}
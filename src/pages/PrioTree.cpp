@@ -33,11 +33,7 @@ void DevTools::drawPrioHandler(CCTouchHandler* handler) {
             DevTools::get()->selectNode(node);
             selected = true;
 
-            CCNode* parent = node->getParent();
-            while (parent) {
-                m_nodeOpen[parent] = true;
-                parent = parent->getParent();
-            }
+            this->expandToNode(node);
         }
         if (expanded) {
             ImGui::TreePop();
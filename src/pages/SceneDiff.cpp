@@ -0,0 +1,243 @@
+#include "../fonts/FeatherIcons.hpp"
+#include "../DevTools.hpp"
+#include "../platform/utils.hpp"
+
+using namespace geode::prelude;
+
+// every capture of a big scene is a few megabytes
+static constexpr size_t MAX_SCENE_CAPTURES = 8;
+static constexpr int LIVE_SCENE = -1;
+
+static char const* diffKindName(SceneDiffKind kind) {
+    switch (kind) {
+        case SceneDiffKind::Added: return "Added";
+        case SceneDiffKind::Removed: return "Removed";
+        case SceneDiffKind::Moved: return "Moved";
+        case SceneDiffKind::Changed: return "Changed";
+    }
+    return "";
+}
+
+static ImVec4 diffKindColor(SceneDiffKind kind) {
+    switch (kind) {
+        case SceneDiffKind::Added: return ImVec4(.4f, 1.f, .4f, 1.f);
+        case SceneDiffKind::Removed: return ImVec4(1.f, .4f, .4f, 1.f);
+        case SceneDiffKind::Moved: return ImVec4(.4f, .7f, 1.f, 1.f);
+        case SceneDiffKind::Changed: return ImVec4(1.f, .8f, .3f, 1.f);
+    }
+    return ImVec4(1.f, 1.f, 1.f, 1.f);
+}
+
+static void formatDiffDetails(fmt::memory_buffer& out, SceneDiffEntry const& entry, SceneCapture::Node const& a, SceneCapture::Node const& b) {
+    auto it = std::back_inserter(out);
+    if (entry.fields & scene_diff_field::Position) {
+        it = fmt::format_to(it, "pos ({}, {}) -> ({}, {}) ", a.x, a.y, b.x, b.y);
+    }
+    if (entry.fields & scene_diff_field::Scale) {
+        it = fmt::format_to(it, "scale ({}, {}) -> ({}, {}) ", a.scaleX, a.scaleY, b.scaleX, b.scaleY);
+    }
+    if (entry.fields & scene_diff_field::Rotation) {
+        it = fmt::format_to(it, "rotation {} -> {} ", a.rotation, b.rotation);
+    }
+    if (entry.fields & scene_diff_field::Visible) {
+        it = fmt::format_to(it, "visible {} -> {} ", a.visible, b.visible);
+    }
+    if (entry.fields & scene_diff_field::ZOrder) {
+        it = fmt::format_to(it, "z {} -> {} ", a.zOrder, b.zOrder);
+    }
+    if (entry.fields & scene_diff_field::Tag) {
+        it = fmt::format_to(it, "tag {} -> {} ", a.tag, b.tag);
+    }
+    if (entry.fields & scene_diff_field::Opacity) {
+        it = fmt::format_to(it, "opacity {} -> {} ", a.opacity, b.opacity);
+    }
+}
+
+void DevTools::takeSceneSnapshot() {
+    auto scene = CCDirector::get()->getRunningScene();
+    if (!scene) return;
+
+    // scenes are usually named after their first layer
+    std::string_view layer = "empty";
+    if (scene->getChildrenCount()) {
+        layer = getObjectClassName(static_cast<CCNode*>(scene->getChildren()->objectAtIndex(0)));
+    }
+    if (m_sceneCaptures.size() >= MAX_SCENE_CAPTURES) {
+        m_sceneCaptures.erase(m_sceneCaptures.begin());
+    }
+    m_sceneCaptures.push_back(SceneCapture::capture(scene, fmt::format("#{} {}", ++m_sceneCaptureCount, layer)));
+    m_diffBefore = static_cast<int>(m_sceneCaptures.size()) - 1;
+    m_diffAfter = LIVE_SCENE;
+    this->clearSceneDiff();
+}
+
+void DevTools::clearSceneDiff() {
+    m_sceneDiff.clear();
+    m_sceneDiffRows.clear();
+    m_sceneDiffCounts.fill(0);
+    m_diffCompared = { LIVE_SCENE, LIVE_SCENE };
+}
+
+void DevTools::compareSceneSnapshots() {
+    m_diffBefore = std::clamp(m_diffBefore, 0, static_cast<int>(m_sceneCaptures.size()) - 1);
+    if (m_diffAfter >= static_cast<int>(m_sceneCaptures.size())) {
+        m_diffAfter = LIVE_SCENE;
+    }
+    if (m_diffAfter == LIVE_SCENE) {
+        m_diffLive = SceneCapture::capture(CCDirector::get()->getRunningScene(), "Live scene");
+    }
+    m_diffCompared = { m_diffBefore, m_diffAfter };
+
+    auto& before = m_sceneCaptures[m_diffBefore];
+    auto& after = m_diffAfter == LIVE_SCENE ? m_diffLive : m_sceneCaptures[m_diffAfter];
+    m_sceneDiff = diffScenes(before, after);
+    // keep related entries together in the list
+    std::sort(m_sceneDiff.begin(), m_sceneDiff.end(), [&](auto const& a, auto const& b) {
+        auto pathA = a.after != SceneDiffEntry::NO_NODE ? after.getPath(after.nodes[a.after]) : before.getPath(before.nodes[a.before]);
+        auto pathB = b.after != SceneDiffEntry::NO_NODE ? after.getPath(after.nodes[b.after]) : before.getPath(before.nodes[b.before]);
+        return pathA < pathB;
+    });
+
+    m_sceneDiffCounts.fill(0);
+    for (auto& entry : m_sceneDiff) {
+        m_sceneDiffCounts[static_cast<size_t>(entry.kind)] += 1;
+    }
+    m_sceneDiffFilterDirty = true;
+}
+
+void DevTools::drawSceneDiff() {
+    if (ImGui::Button(U8STR(FEATHER_X " Close"))) {
+        m_showSceneDiff = false;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_CAMERA " Take Snapshot"))) {
+        this->takeSceneSnapshot();
+    }
+
+    if (m_sceneCaptures.empty()) {
+        ImGui::TextWrapped("Take a snapshot of the scene to compare it against the live scene or another snapshot later");
+        return;
+    }
+
+    auto captureName = [&](int index) -> char const* {
+        if (index == LIVE_SCENE || index >= static_cast<int>(m_sceneCaptures.size())) return "Live scene";
+        return m_sceneCaptures[index].name.c_str();
+    };
+
+    m_diffBefore = std::clamp(m_diffBefore, 0, static_cast<int>(m_sceneCaptures.size()) - 1);
+    if (ImGui::BeginCombo("Before", captureName(m_diffBefore))) {
+        for (int i = 0; i < static_cast<int>(m_sceneCaptures.size()); i++) {
+            if (ImGui::Selectable(captureName(i), i == m_diffBefore)) {
+                m_diffBefore = i;
+            }
+        }
+        ImGui::EndCombo();
+    }
+    if (ImGui::BeginCombo("After", captureName(m_diffAfter))) {
+        if (ImGui::Selectable("Live scene", m_diffAfter == LIVE_SCENE)) {
+            m_diffAfter = LIVE_SCENE;
+        }
+        for (int i = 0; i < static_cast<int>(m_sceneCaptures.size()); i++) {
+            if (ImGui::Selectable(captureName(i), i == m_diffAfter)) {
+                m_diffAfter = i;
+            }
+        }
+        ImGui::EndCombo();
+    }
+
+    if (ImGui::Button(U8STR(FEATHER_COLUMNS " Compare"))) {
+        this->compareSceneSnapshots();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_TRASH_2 " Delete Snapshot"))) {
+        m_sceneCaptures.erase(m_sceneCaptures.begin() + m_diffBefore);
+        m_diffAfter = LIVE_SCENE;
+        this->clearSceneDiff();
+        return;
+    }
+
+    // entries point into the captures that were compared
+    if (m_diffCompared.first == LIVE_SCENE || m_diffCompared.first >= static_cast<int>(m_sceneCaptures.size())) {
+        return;
+    }
+    auto& before = m_sceneCaptures[m_diffCompared.first];
+    auto& after = m_diffCompared.second == LIVE_SCENE ? m_diffLive : m_sceneCaptures[m_diffCompared.second];
+
+    ImGui::Text(
+        "%zu nodes before, %zu after: %zu added, %zu removed, %zu moved, %zu changed",
+        before.nodes.size(), after.nodes.size(),
+        m_sceneDiffCounts[0], m_sceneDiffCounts[1], m_sceneDiffCounts[2], m_sceneDiffCounts[3]
+    );
+    for (size_t i = 0; i < m_sceneDiffShown.size(); i++) {
+        if (i) ImGui::SameLine();
+        auto kind = static_cast<SceneDiffKind>(i);
+        ImGui::PushStyleColor(ImGuiCol_Text, diffKindColor(kind));
+        m_sceneDiffFilterDirty |= ImGui::Checkbox(diffKindName(kind), &m_sceneDiffShown[i]);
+        ImGui::PopStyleColor();
+    }
+
+    if (m_sceneDiffFilterDirty) {
+        m_sceneDiffFilterDirty = false;
+        m_sceneDiffRows.clear();
+        for (size_t i = 0; i < m_sceneDiff.size(); i++) {
+            if (m_sceneDiffShown[static_cast<size_t>(m_sceneDiff[i].kind)]) {
+                m_sceneDiffRows.push_back(i);
+            }
+        }
+    }
+
+    auto flags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+    if (!ImGui::BeginTable("scene-diff", 3, flags)) {
+        return;
+    }
+    ImGui::TableSetupScrollFreeze(0, 1);
+    ImGui::TableSetupColumn("Change", ImGuiTableColumnFlags_WidthFixed);
+    ImGui::TableSetupColumn("Path");
+    ImGui::TableSetupColumn("Details");
+    ImGui::TableHeadersRow();
+
+    static fmt::memory_buffer details;
+    auto registry = NodeRegistry::get();
+    ImGuiListClipper clipper;
+    clipper.Begin(static_cast<int>(m_sceneDiffRows.size()));
+    while (clipper.Step()) {
+        for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++) {
+            auto& entry = m_sceneDiff[m_sceneDiffRows[row]];
+            auto beforeNode = entry.before != SceneDiffEntry::NO_NODE ? &before.nodes[entry.before] : nullptr;
+            auto afterNode = entry.after != SceneDiffEntry::NO_NODE ? &after.nodes[entry.after] : nullptr;
+            auto path = afterNode ? after.getPath(*afterNode) : before.getPath(*beforeNode);
+
+            ImGui::PushID(row);
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::PushStyleColor(ImGuiCol_Text, diffKindColor(entry.kind));
+            bool clicked = ImGui::Selectable(diffKindName(entry.kind), false, ImGuiSelectableFlags_SpanAllColumns);
+            ImGui::PopStyleColor();
+
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(path.data(), path.data() + path.size());
+
+            ImGui::TableNextColumn();
+            details.clear();
+            if (entry.kind == SceneDiffKind::Moved) {
+                fmt::format_to(std::back_inserter(details), "from {} ", before.getPath(*beforeNode));
+            }
+            if (beforeNode && afterNode) {
+                formatDiffDetails(details, entry, *beforeNode, *afterNode);
+            }
+            ImGui::TextUnformatted(details.data(), details.data() + details.size());
+            ImGui::PopID();
+
+            // only nodes that are still around can be selected
+            auto identity = afterNode ? afterNode->identity : beforeNode->identity;
+            if (clicked) {
+                if (auto node = registry->find(identity)) {
+                    this->selectNode(node);
+                    this->expandToNode(node);
+                    m_scrollToNode = node;
+                }
+            }
+        }
+    }
+    ImGui::EndTable();
+}
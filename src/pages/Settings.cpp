@@ -1,4 +1,5 @@
 #include "../DevTools.hpp"
+#include "../InspectionServer.hpp"
 #include <Geode/loader/Loader.hpp>
 #include <Geode/loader/Mod.hpp>
 #include <Geode/utils/ranges.hpp>
@@ -43,6 +44,21 @@ void DevTools::drawSettings() {
             "Highlights the borders of all layouts applied to nodes"
         );
     }
+    ImGui::Checkbox("Show All Bounds", &m_settings.showAllBounds);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip(
+            "Draws the bounding box of every visible node in the scene.\n"
+            "Useful for spotting offscreen or oversized nodes."
+        );
+    }
+    if (m_settings.showAllBounds) {
+        ImGui::Checkbox("Color Bounds by Class", &m_settings.boundsByClass);
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip(
+                "Colors the bounding boxes by node class instead of tree depth."
+            );
+        }
+    }
     ImGui::Checkbox("Arrow to Expand", &m_settings.arrowExpand);
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip(
@@ -64,7 +80,9 @@ void DevTools::drawSettings() {
             "(Experimental)\nAllows you to drag/drop nodes in the node tree, changing\ntheir parents or ordering."
         );
     }
-    ImGui::Checkbox("Hide Flagged Nodes", &m_settings.hideFlaggedNodes);
+    if (ImGui::Checkbox("Hide Flagged Nodes", &m_settings.hideFlaggedNodes)) {
+        this->invalidateTree();
+    }
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip(
             "If enabled, hides nodes in the node tree with the \"geode.devtools/hide\"\n"
@@ -72,6 +90,18 @@ void DevTools::drawSettings() {
             "This will keep the children of those nodes visible in the node tree."
         );
     }
+    if (ImGui::Checkbox("Inspection Server", &m_settings.inspectionServer)) {
+        InspectionServer::get()->setEnabled(m_settings.inspectionServer);
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip(
+            "Lets external tools inspect and edit the node tree through a\n"
+            "server on localhost port %d. Only reachable from this machine,\n"
+            "and clients have to send the token from inspection-token in\n"
+            "the mod's save folder first.",
+            InspectionServer::PORT
+        );
+    }
     ImGui::Checkbox("Advanced Settings", &m_settings.advancedSettings);
     if (ImGui::IsItemHovered()) {
         ImGui::SetTooltip(
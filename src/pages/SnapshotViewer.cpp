@@ -0,0 +1,239 @@
+#include "../fonts/FeatherIcons.hpp"
+#include "../DevTools.hpp"
+#include <Geode/loader/Mod.hpp>
+#include <cmath>
+#include <ctime>
+
+using namespace geode::prelude;
+namespace bs = binary_snapshot;
+
+// same idea as the pages in the Tree
+static constexpr uint32_t SNAPSHOT_PAGE_SIZE = 1000;
+
+static std::filesystem::path getSnapshotDir() {
+    return Mod::get()->getSaveDir() / "snapshots";
+}
+
+void DevTools::exportBinarySnapshot() {
+    auto path = getSnapshotDir() / fmt::format("scene-{}.dtsn", std::time(nullptr));
+    auto error = writeBinarySnapshot(CCDirector::get()->getRunningScene(), path);
+    if (error.empty()) {
+        m_binarySnapshotStatus = fmt::format("Exported to {}", path.filename().string());
+    }
+    else {
+        m_binarySnapshotStatus = fmt::format("Export failed: {}", error);
+    }
+    m_snapshotFilesDirty = true;
+    m_showSnapshotViewer = true;
+}
+
+void DevTools::drawBinarySnapshotChildren(bs::Node const& parent, uint32_t index) {
+    auto nodes = m_binarySnapshot.nodes();
+    auto child = index + 1;
+    for (uint32_t i = 0; i < parent.childCount; i++) {
+        // a corrupted file shouldn't send us reading out of bounds
+        if (child >= nodes.size()) return;
+
+        if (parent.childCount > SNAPSHOT_PAGE_SIZE && i % SNAPSHOT_PAGE_SIZE == 0) {
+            auto end = std::min(i + SNAPSHOT_PAGE_SIZE, parent.childCount) - 1;
+            ImGui::PushID(static_cast<int>(index));
+            bool open = ImGui::TreeNode(reinterpret_cast<void*>(static_cast<uintptr_t>(i)), "[%u..%u]", i, end);
+            ImGui::PopID();
+            if (!open) {
+                // skip the whole page
+                for (uint32_t j = i; j <= end && child < nodes.size(); j++) {
+                    child += std::max(nodes[child].subtreeSize, 1u);
+                }
+                i = end;
+                continue;
+            }
+            for (uint32_t j = i; j <= end && child < nodes.size(); j++) {
+                this->drawBinarySnapshotNode(child, j);
+                child += std::max(nodes[child].subtreeSize, 1u);
+            }
+            ImGui::TreePop();
+            i = end;
+            continue;
+        }
+
+        this->drawBinarySnapshotNode(child, i);
+        child += std::max(nodes[child].subtreeSize, 1u);
+    }
+}
+
+void DevTools::drawBinarySnapshotNode(uint32_t index, uint32_t siblingIndex) {
+    auto& node = m_binarySnapshot.nodes()[index];
+
+    static fmt::memory_buffer label;
+    label.clear();
+    auto out = fmt::format_to(std::back_inserter(label), "[{}] {} ", siblingIndex, m_binarySnapshot.getString(node.className));
+    if (node.tag != -1) {
+        out = fmt::format_to(out, "({}) ", node.tag);
+    }
+    if (auto id = m_binarySnapshot.getString(node.id); id.size()) {
+        out = fmt::format_to(out, "\"{}\" ", id);
+    }
+    if (node.childCount) {
+        out = fmt::format_to(out, "<{}> ", node.childCount);
+    }
+    label.push_back('\0');
+
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow;
+    if (!node.childCount) {
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    }
+    if (index == m_binarySnapshotSelected) {
+        flags |= ImGuiTreeNodeFlags_Selected;
+    }
+
+    auto alpha = ImGui::GetStyle().DisabledAlpha;
+    ImGui::GetStyle().DisabledAlpha = alpha + 0.15f;
+    ImGui::BeginDisabled(!(node.flags & bs::Visible));
+    ImGui::PushItemFlag(ImGuiItemFlags_Disabled, false);
+    bool open = ImGui::TreeNodeEx(reinterpret_cast<void*>(static_cast<uintptr_t>(index)), flags, "%s", label.data());
+    ImGui::PopItemFlag();
+    ImGui::EndDisabled();
+    ImGui::GetStyle().DisabledAlpha = alpha;
+
+    if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen()) {
+        m_binarySnapshotSelected = index;
+    }
+    if (open) {
+        this->drawBinarySnapshotChildren(node, index);
+        ImGui::TreePop();
+    }
+}
+
+void DevTools::drawBinarySnapshotAttributes(bs::Node const& node) {
+    auto str = [&](uint32_t index) {
+        auto view = m_binarySnapshot.getString(index);
+        return std::string(view);
+    };
+
+    ImGui::Text("Class: %s", str(node.className).c_str());
+    ImGui::Text("ID: %s", str(node.id).c_str());
+    ImGui::Text("Tag: %d", node.tag);
+    ImGui::Text("Z Order: %d", node.zOrder);
+    ImGui::Text("Visible: %s", (node.flags & bs::Visible) ? "true" : "false");
+    ImGui::Text("Position: %.2f, %.2f", node.x, node.y);
+    ImGui::Text("Scale: %.2f, %.2f", node.scaleX, node.scaleY);
+    ImGui::Text("Rotation: %.2f, %.2f", node.rotationX, node.rotationY);
+    ImGui::Text("Skew: %.2f, %.2f", node.skewX, node.skewY);
+    ImGui::Text("Anchor Point: %.2f, %.2f", node.anchorX, node.anchorY);
+    ImGui::Text("Content Size: %.2f, %.2f", node.width, node.height);
+    if (node.flags & bs::IgnoreAnchorPointForPosition) {
+        ImGui::Text("Ignores anchor point for position");
+    }
+    if (node.flags & bs::HasColor) {
+        ImGui::Text("Color: %u, %u, %u", node.color[0], node.color[1], node.color[2]);
+        ImGui::SameLine();
+        ImGui::ColorButton("##snapshot-color", ImVec4(node.color[0] / 255.f, node.color[1] / 255.f, node.color[2] / 255.f, node.opacity / 255.f));
+        ImGui::Text("Opacity: %u", node.opacity);
+    }
+    if (node.layout != bs::NONE) {
+        ImGui::Text("Layout: %s", str(node.layout).c_str());
+    }
+
+    auto opts = m_binarySnapshot.getLayoutOptions(node);
+    if (!opts) return;
+
+    ImGui::Text("Layout options: %s", str(opts->className).c_str());
+    auto value = [&](char const* name, float v) {
+        if (std::isnan(v)) {
+            ImGui::Text("%s: unset", name);
+        }
+        else {
+            ImGui::Text("%s: %.2f", name, v);
+        }
+    };
+    switch (opts->kind) {
+        case bs::LayoutOptionsKind::SimpleAxis: {
+            value("Min Relative Scale", opts->values[0]);
+            value("Max Relative Scale", opts->values[1]);
+            value("Scaling Priority", opts->values[2]);
+        } break;
+
+        case bs::LayoutOptionsKind::Axis: {
+            ImGui::Text("Auto Scale: %s", (opts->flags & 1) ? ((opts->flags & 2) ? "enabled" : "disabled") : "default");
+            ImGui::Text("Break Line: %s", (opts->flags & 4) ? "true" : "false");
+            ImGui::Text("Same Line: %s", (opts->flags & 8) ? "true" : "false");
+            value("Length", opts->values[0]);
+            value("Prev Gap", opts->values[1]);
+            value("Next Gap", opts->values[2]);
+            value("Relative Scale", opts->values[3]);
+            value("Min Scale", opts->values[4]);
+            value("Max Scale", opts->values[5]);
+            value("Scale Priority", opts->values[6]);
+            value("Cross Axis Alignment", opts->values[7]);
+        } break;
+
+        case bs::LayoutOptionsKind::Anchor: {
+            value("Offset X", opts->values[0]);
+            value("Offset Y", opts->values[1]);
+            value("Anchor", opts->values[2]);
+        } break;
+
+        default: break;
+    }
+}
+
+void DevTools::drawSnapshotViewer() {
+    if (ImGui::Button(U8STR(FEATHER_X " Close"))) {
+        m_showSnapshotViewer = false;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_DOWNLOAD " Export Scene"))) {
+        this->exportBinarySnapshot();
+    }
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_REFRESH_CW " Refresh"))) {
+        m_snapshotFilesDirty = true;
+    }
+    if (!m_binarySnapshotStatus.empty()) {
+        ImGui::TextWrapped("%s", m_binarySnapshotStatus.c_str());
+    }
+
+    if (m_snapshotFilesDirty) {
+        m_snapshotFilesDirty = false;
+        m_snapshotFiles.clear();
+        std::error_code ec;
+        for (auto& entry : std::filesystem::directory_iterator(getSnapshotDir(), ec)) {
+            if (entry.path().extension() == ".dtsn") {
+                m_snapshotFiles.push_back(entry.path());
+            }
+        }
+        std::sort(m_snapshotFiles.begin(), m_snapshotFiles.end());
+    }
+
+    auto current = m_binarySnapshotPath.filename().string();
+    if (ImGui::BeginCombo("File", current.empty() ? "Select a snapshot" : current.c_str())) {
+        for (auto& path : m_snapshotFiles) {
+            auto name = path.filename().string();
+            if (ImGui::Selectable(name.c_str(), path == m_binarySnapshotPath)) {
+                std::string error;
+                m_binarySnapshot = BinarySnapshot::open(path, &error);
+                m_binarySnapshotPath = path;
+                m_binarySnapshotSelected = bs::NONE;
+                m_binarySnapshotStatus = m_binarySnapshot.isOpen() ?
+                    fmt::format("{} nodes", m_binarySnapshot.nodes().size()) :
+                    fmt::format("Unable to open {}: {}", name, error);
+            }
+        }
+        ImGui::EndCombo();
+    }
+
+    if (!m_binarySnapshot.isOpen() || m_binarySnapshot.nodes().empty()) {
+        return;
+    }
+
+    auto nodes = m_binarySnapshot.nodes();
+    if (m_binarySnapshotSelected < nodes.size()) {
+        if (ImGui::CollapsingHeader("Selected Node", ImGuiTreeNodeFlags_DefaultOpen)) {
+            this->drawBinarySnapshotAttributes(nodes[m_binarySnapshotSelected]);
+        }
+        ImGui::Separator();
+    }
+
+    // the root is always the first node
+    this->drawBinarySnapshotNode(0, 0);
+}
@@ -0,0 +1,272 @@
+#include "../fonts/FeatherIcons.hpp"
+#include "../DevTools.hpp"
+#include "../platform/utils.hpp"
+#include <algorithm>
+
+using namespace geode::prelude;
+
+static constexpr size_t STATS_TOP_CLASSES = 10;
+
+namespace {
+    void countNode(SubtreeStats& stats, SubtreeStats::Node const& node, int sign) {
+        auto adjust = [&](size_t& count) {
+            if (sign > 0) count += 1;
+            else count -= 1;
+        };
+        adjust(stats.nodeCount);
+        adjust(node.visible ? stats.visibleCount : stats.invisibleCount);
+        if (node.layout) adjust(stats.layoutCount);
+        if (stats.depthCounts.size() <= node.depth) {
+            stats.depthCounts.resize(node.depth + 1);
+        }
+        adjust(stats.depthCounts[node.depth]);
+        auto& classCount = stats.classCounts[node.className];
+        adjust(classCount);
+        if (classCount == 0) {
+            stats.classCounts.erase(node.className);
+        }
+    }
+
+    void addBranch(SubtreeStats& stats, CCNode* root, CCNode* parent, size_t depth, bool visible) {
+        auto registry = NodeRegistry::get();
+        struct Entry {
+            CCNode* node;
+            CCNode* parent;
+            size_t depth;
+            bool visible;
+        };
+        std::vector<Entry> stack;
+        stack.push_back({ root, parent, depth, visible && root->isVisible() });
+        while (!stack.empty()) {
+            auto [node, parent, depth, visible] = stack.back();
+            stack.pop_back();
+            auto [it, inserted] = stats.nodes.try_emplace(node);
+            // a node added to itself somewhere would loop forever otherwise
+            if (!inserted) {
+                continue;
+            }
+
+            auto& entry = it->second;
+            entry = {
+                .identity = registry->identify(node),
+                .parent = parent,
+                .depth = depth,
+                .className = getObjectClassName(node),
+                .visible = visible,
+                .layout = node->getLayout() != nullptr,
+            };
+            countNode(stats, entry, 1);
+
+            for (auto child : CCArrayExt<CCNode*>(node->getChildren())) {
+                entry.children.push_back(child);
+                stack.push_back({ child, node, depth + 1, visible && child->isVisible() });
+            }
+        }
+    }
+
+    // only goes by what was stored, the nodes may be gone already
+    void removeBranch(SubtreeStats& stats, CCNode* root) {
+        std::vector<CCNode*> stack { root };
+        while (!stack.empty()) {
+            auto it = stats.nodes.find(stack.back());
+            stack.pop_back();
+            if (it == stats.nodes.end()) continue;
+            countNode(stats, it->second, -1);
+            stack.insert(stack.end(), it->second.children.begin(), it->second.children.end());
+            stats.nodes.erase(it);
+        }
+    }
+
+    // recounts a node shown or hidden along with its branch, which is only visible if all of it is
+    void updateVisibility(SubtreeStats& stats, CCNode* root) {
+        auto registry = NodeRegistry::get();
+        auto rootIt = stats.nodes.find(root);
+        if (rootIt == stats.nodes.end()) return;
+        auto parentIt = stats.nodes.find(rootIt->second.parent);
+        bool parentVisible = parentIt == stats.nodes.end() || parentIt->second.visible;
+
+        std::vector<std::pair<CCNode*, bool>> stack { { root, parentVisible } };
+        while (!stack.empty()) {
+            auto [node, parentVisible] = stack.back();
+            stack.pop_back();
+            auto it = stats.nodes.find(node);
+            if (it == stats.nodes.end() || registry->find(it->second.identity) != node) continue;
+            auto& entry = it->second;
+            bool visible = parentVisible && node->isVisible();
+            // nothing below changes either, unless it has an entry of its own
+            if (visible == entry.visible) continue;
+
+            (entry.visible ? stats.visibleCount : stats.invisibleCount) -= 1;
+            (visible ? stats.visibleCount : stats.invisibleCount) += 1;
+            entry.visible = visible;
+            for (auto child : entry.children) {
+                stack.push_back({ child, visible });
+            }
+        }
+    }
+
+    // brings the children of a node that is known to be alive in line with what it has now
+    void reconcileChildren(SubtreeStats& stats, CCNode* parent) {
+        auto& entry = stats.nodes.at(parent);
+        auto depth = entry.depth + 1;
+        auto visible = entry.visible;
+        auto previous = std::move(entry.children);
+
+        std::unordered_set<CCNode*> current;
+        std::vector<CCNode*> children;
+        for (auto child : CCArrayExt<CCNode*>(parent->getChildren())) {
+            current.insert(child);
+            children.push_back(child);
+        }
+        for (auto child : previous) {
+            auto it = stats.nodes.find(child);
+            // moved somewhere else in the subtree and already counted there
+            if (it == stats.nodes.end() || it->second.parent != parent) continue;
+            if (!current.contains(child)) {
+                removeBranch(stats, child);
+            }
+        }
+        for (auto child : children) {
+            auto it = stats.nodes.find(child);
+            if (it != stats.nodes.end() && it->second.parent == parent) continue;
+            // moved here from elsewhere in the subtree
+            if (it != stats.nodes.end()) {
+                removeBranch(stats, child);
+            }
+            addBranch(stats, child, parent, depth, visible);
+        }
+        entry.children = std::move(children);
+    }
+}
+
+void DevTools::updateSubtreeStats(CCNode* root) {
+    auto& stats = m_subtreeStats;
+    auto identity = NodeRegistry::get()->identify(root);
+    auto journal = SceneJournal::get();
+    auto registry = NodeRegistry::get();
+
+    if (stats.root != identity) {
+        stats.root = identity;
+        stats.dirty = true;
+    }
+    std::unordered_set<CCNode*> parents;
+    std::unordered_set<CCNode*> shown;
+    std::unordered_set<CCNode*> layouts;
+    if (!stats.dirty) {
+        bool complete = journal->forEachSince(stats.journalGeneration, [&](SceneChange const& change) {
+            switch (change.type) {
+                case SceneChangeType::AddChild:
+                case SceneChangeType::RemoveChild: {
+                    if (stats.nodes.contains(change.parent)) parents.insert(change.parent);
+                } break;
+
+                case SceneChangeType::RemoveAllChildren: {
+                    if (stats.nodes.contains(change.node)) parents.insert(change.node);
+                } break;
+
+                case SceneChangeType::SetVisible: {
+                    if (stats.nodes.contains(change.node)) shown.insert(change.node);
+                } break;
+
+                case SceneChangeType::SetLayout: {
+                    if (stats.nodes.contains(change.node)) layouts.insert(change.node);
+                } break;
+
+                default: break;
+            }
+        });
+        if (!complete) {
+            stats.dirty = true;
+        }
+    }
+    stats.journalGeneration = journal->generation();
+
+    if (stats.dirty) {
+        stats = SubtreeStats {
+            .root = identity,
+            .journalGeneration = stats.journalGeneration,
+            .dirty = false,
+        };
+        addBranch(stats, root, nullptr, 0, true);
+    }
+    else if (!parents.empty() || !shown.empty() || !layouts.empty()) {
+        for (auto parent : parents) {
+            // removed along with an ancestor already, or freed and its address reused
+            auto it = stats.nodes.find(parent);
+            if (it == stats.nodes.end() || registry->find(it->second.identity) != parent) continue;
+            reconcileChildren(stats, parent);
+        }
+        // branches added above are counted as they are now already
+        for (auto node : shown) {
+            updateVisibility(stats, node);
+        }
+        for (auto node : layouts) {
+            auto it = stats.nodes.find(node);
+            if (it == stats.nodes.end() || registry->find(it->second.identity) != node) continue;
+            bool layout = node->getLayout() != nullptr;
+            if (layout != it->second.layout) {
+                if (layout) stats.layoutCount += 1;
+                else stats.layoutCount -= 1;
+                it->second.layout = layout;
+            }
+        }
+    }
+    else {
+        return;
+    }
+
+    while (!stats.depthCounts.empty() && stats.depthCounts.back() == 0) {
+        stats.depthCounts.pop_back();
+    }
+    stats.maxDepth = stats.depthCounts.empty() ? 0 : stats.depthCounts.size() - 1;
+    stats.classes.assign(stats.classCounts.begin(), stats.classCounts.end());
+    std::sort(stats.classes.begin(), stats.classes.end(), [](auto const& a, auto const& b) {
+        return a.second != b.second ? a.second > b.second : a.first < b.first;
+    });
+}
+
+void DevTools::drawStatisticsAttributes(CCNode* node) {
+    if (!ImGui::CollapsingHeader(U8STR(FEATHER_LIST " Subtree Statistics"))) {
+        return;
+    }
+    if (ImGui::Button(U8STR(FEATHER_REFRESH_CW " Refresh"))) {
+        m_subtreeStats.dirty = true;
+    }
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip("Counts follow changes to the scene as they happen, this counts everything again from scratch");
+    }
+    this->updateSubtreeStats(node);
+
+    auto& stats = m_subtreeStats;
+    ImGui::Text("Nodes: %zu", stats.nodeCount);
+    ImGui::Text("Max depth: %zu", stats.maxDepth);
+    ImGui::Text("Visible: %zu", stats.visibleCount);
+    ImGui::SameLine();
+    ImGui::TextDisabled("Invisible: %zu", stats.invisibleCount);
+    ImGui::Text("Nodes with layouts: %zu", stats.layoutCount);
+
+    auto drawClasses = [&](size_t count) {
+        if (ImGui::BeginTable("subtree-classes", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+            ImGui::TableSetupColumn("Class");
+            ImGui::TableSetupColumn("Count", ImGuiTableColumnFlags_WidthFixed);
+            ImGui::TableHeadersRow();
+            for (size_t i = 0; i < count; i++) {
+                auto& [name, amount] = stats.classes[i];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                ImGui::TextUnformatted(name.data(), name.data() + name.size());
+                ImGui::TableNextColumn();
+                ImGui::Text("%zu", amount);
+            }
+            ImGui::EndTable();
+        }
+    };
+
+    drawClasses(std::min(stats.classes.size(), STATS_TOP_CLASSES));
+    if (stats.classes.size() > STATS_TOP_CLASSES) {
+        if (ImGui::TreeNode("subtree-all-classes", "All classes (%zu)", stats.classes.size())) {
+            drawClasses(stats.classes.size());
+            ImGui::TreePop();
+        }
+    }
+}
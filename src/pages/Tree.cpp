@@ -6,6 +6,9 @@
 #include <misc/cpp/imgui_stdlib.h>
 #include <Geode/utils/string.hpp>
 #include "../ImGui.hpp"
+#include "../JsonExport.hpp"
+#include "../NodeLabel.hpp"
+#include <Geode/utils/file.hpp>
 
 #ifndef GEODE_IS_WINDOWS
 #include <cxxabi.h>
@@ -13,20 +16,25 @@
 
 using namespace geode::prelude;
 
+// Children past this are split into pages in the Tree, so a node with a huge amount
+// of children doesn't turn into a huge amount of rows as soon as it's expanded
+static constexpr size_t TREE_PAGE_SIZE = 1000;
+
+static NodeLabelParts getNodeLabelParts(CCNode* node, size_t index, bool fake, bool flagHidden) {
+    return {
+        .className = getObjectClassName(node),
+        .id = node->getID(),
+        .tag = node->getTag(),
+        .childCount = node->getChildrenCount(),
+        .index = index,
+        .fake = fake,
+        .flagHidden = flagHidden,
+    };
+}
+
 std::string formatNodeName(CCNode* node, size_t index, bool fake, bool flagHidden) {
-    std::string prefix = "";
-    if (fake) prefix += "*";
-    if (flagHidden) prefix += "...";
-    std::string name = fmt::format("[{}{}] {} ", prefix, index, geode::cocos::getObjectName(node));
-    if (node->getTag() != -1) {
-        name += fmt::format("({}) ", node->getTag());
-    }
-    if (node->getID().size()) {
-        name += fmt::format("\"{}\" ", node->getID());
-    }
-    if (node->getChildrenCount()) {
-        name += fmt::format("<{}> ", node->getChildrenCount());
-    }
+    std::string name;
+    formatNodeNameTo(name, getNodeLabelParts(node, index, fake, flagHidden));
     return name;
 }
 
@@ -39,25 +47,353 @@ bool isNodeParentOf(CCNode* parent, CCNode* child) {
     return false;
 }
 
-void DevTools::drawTreeBranch(CCNode* node, size_t index, TreeBranchOptions options) {
-    if (!this->searchBranch(node)) {
+bool DevTools::isTreeNodeOpen(uint64_t identity) {
+    // while searching every matching branch starts out expanded
+    if (!m_searchQuery.empty()) {
+        return !m_searchCollapsed.contains(identity);
+    }
+    auto it = m_nodeOpen.find(identity);
+    return it != m_nodeOpen.end() && it->second;
+}
+
+bool DevTools::isTreePageOpen(uint64_t identity, size_t page) {
+    if (!m_searchQuery.empty()) {
+        return !m_searchCollapsedPages.contains({ identity, page });
+    }
+    return m_openPages.contains({ identity, page });
+}
+
+static void erasePages(std::set<std::pair<uint64_t, size_t>>& pages, uint64_t identity) {
+    pages.erase(pages.lower_bound({ identity, 0 }), pages.lower_bound({ identity + 1, 0 }));
+}
+
+void DevTools::compactNodeState(bool shrink) {
+    auto registry = NodeRegistry::get();
+    if (registry->takeReleased(m_releasedNodes)) {
+        for (auto identity : m_releasedNodes) {
+            m_nodeOpen.erase(identity);
+            m_searchCollapsed.erase(identity);
+            m_treeLabels.erase(identity);
+            m_nodeUserStates.erase(identity);
+            erasePages(m_openPages, identity);
+            erasePages(m_searchCollapsedPages, identity);
+        }
+    }
+    else {
+        std::erase_if(m_nodeOpen, [&](auto const& pair) { return !registry->find(pair.first); });
+        std::erase_if(m_searchCollapsed, [&](auto identity) { return !registry->find(identity); });
+        std::erase_if(m_treeLabels, [&](auto const& pair) { return !registry->find(pair.first); });
+        std::erase_if(m_nodeUserStates, [&](auto const& pair) { return !registry->find(pair.first); });
+        std::erase_if(m_openPages, [&](auto const& pair) { return !registry->find(pair.first); });
+        std::erase_if(m_searchCollapsedPages, [&](auto const& pair) { return !registry->find(pair.first); });
+    }
+    m_releasedNodes.clear();
+
+    if (shrink) {
+        m_nodeOpen.rehash(0);
+        m_searchCollapsed.rehash(0);
+        m_treeLabels.rehash(0);
+        m_nodeUserStates.rehash(0);
+    }
+}
+
+bool DevTools::isTreeRowVisible(size_t rowIndex) const {
+    for (auto i = rowIndex; i != NO_PARENT_ROW; i = m_treeRows[i].parentRow) {
+        if (!m_treeRows[i].node->isVisible()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void DevTools::expandToNode(CCNode* node) {
+    auto registry = NodeRegistry::get();
+    for (auto child = node, parent = node->getParent(); parent; child = parent, parent = parent->getParent()) {
+        auto identity = registry->identify(parent);
+        m_nodeOpen[identity] = true;
+        m_searchCollapsed.erase(identity);
+        if (parent->getChildrenCount() > TREE_PAGE_SIZE) {
+            auto page = parent->getChildren()->indexOfObject(child) / TREE_PAGE_SIZE;
+            m_openPages.insert({ identity, page });
+            m_searchCollapsedPages.erase({ identity, page });
+        }
+    }
+    m_treeDirty = true;
+}
+
+void DevTools::invalidateTree() {
+    m_treeDirty = true;
+    m_searchIndexDirty = true;
+}
+
+void DevTools::clearTreeCaches() {
+    // rows and search results keep their nodes alive, don't hold on to them
+    m_treeRows.clear();
+    m_treeRowNodes.clear();
+    m_treeLabels.clear();
+    m_labelArena.reset();
+    m_nodeUserStates.clear();
+    m_searchIndex.clear();
+    m_searchResults.clear();
+    // whatever the worker is doing was meant for the old tree
+    m_searchPending = false;
+    m_subtreeStats = SubtreeStats();
+    this->invalidateTree();
+}
+
+void DevTools::buildTreeBranch(CCNode* node, size_t index, TreeRowOptions options) {
+    if (!node || !this->searchBranch(node)) {
         return;
     }
 
-    if (node->getUserFlag("hide"_spr) && m_settings.hideFlaggedNodes) {
-        this->drawNodeChildren(node, {
-            .drag = options.drag,
-            .visible = options.visible,
+    m_treeRowNodes.insert(node);
+
+    if (m_settings.hideFlaggedNodes && this->getNodeUserState(node).hidden) {
+        this->buildNodeChildren(node, {
+            .parentRow = options.parentRow,
+            .depth = options.depth,
+            .fake = false,
             .flagHidden = true
         });
         return;
     }
 
-    options.visible = node->isVisible() && options.visible;
+    auto identity = NodeRegistry::get()->identify(node);
+    auto rowIndex = m_treeRows.size();
+    m_treeRows.push_back({
+        .node = node,
+        .identity = identity,
+        .parent = node->getParent(),
+        .childCount = node->getChildrenCount(),
+        .index = index,
+        .parentRow = options.parentRow,
+        .depth = options.depth,
+        .fake = options.fake,
+        .flagHidden = options.flagHidden
+    });
+
+    // leaf nodes are always expanded as far as imgui is concerned
+    if (!node->getChildrenCount() || this->isTreeNodeOpen(identity)) {
+        this->buildNodeChildren(node, {
+            .parentRow = rowIndex,
+            .depth = options.depth + 1,
+            .fake = false,
+            .flagHidden = false
+        });
+    }
+}
+
+void DevTools::buildNodeChildren(CCNode* node, TreeRowOptions options) {
+    size_t count = node->getChildrenCount();
+    if (count > TREE_PAGE_SIZE) {
+        // huge child lists are split into pages, only the open ones get rows
+        auto children = node->getChildren();
+        auto identity = NodeRegistry::get()->identify(node);
+        for (size_t start = 0, page = 0; start < count; start += TREE_PAGE_SIZE, page++) {
+            auto end = std::min(start + TREE_PAGE_SIZE, count);
+            if (!m_searchQuery.empty()) {
+                bool matched = false;
+                for (auto i = start; i < end && !matched; i++) {
+                    matched = this->searchBranch(static_cast<CCNode*>(children->objectAtIndex(i)));
+                }
+                if (!matched) continue;
+            }
+
+            auto rowIndex = m_treeRows.size();
+            m_treeRows.push_back({
+                .node = node,
+                .identity = identity,
+                .parent = node->getParent(),
+                .childCount = node->getChildrenCount(),
+                .index = page,
+                .parentRow = options.parentRow,
+                .depth = options.depth,
+                .fake = false,
+                .flagHidden = options.flagHidden,
+                .page = true,
+                .pageStart = start,
+                .pageEnd = end
+            });
+            if (!this->isTreePageOpen(identity, page)) continue;
+
+            for (auto i = start; i < end; i++) {
+                this->buildTreeBranch(static_cast<CCNode*>(children->objectAtIndex(i)), i, {
+                    .parentRow = rowIndex,
+                    .depth = options.depth + 1,
+                    .fake = false,
+                    .flagHidden = options.flagHidden
+                });
+            }
+        }
+    }
+    else {
+        size_t i = 0;
+        for (auto& child : CCArrayExt<CCNode*>(node->getChildren())) {
+            this->buildTreeBranch(child, i++, {
+                .parentRow = options.parentRow,
+                .depth = options.depth,
+                .fake = false,
+                .flagHidden = options.flagHidden
+            });
+        }
+    }
+
+    size_t i = 0;
+    if (auto fakeChildren = this->getExtraChildren(node)) {
+        for (auto& child : CCArrayExt<CCNode*>(fakeChildren)) {
+            this->buildTreeBranch(child, i++, {
+                .parentRow = options.parentRow,
+                .depth = options.depth,
+                .fake = true,
+                .flagHidden = options.flagHidden
+            });
+        }
+    }
+}
+
+NodeUserState const& DevTools::getNodeUserState(CCNode* node) {
+    auto [it, inserted] = m_nodeUserStates.try_emplace(NodeRegistry::get()->identify(node));
+    if (inserted) {
+        it->second = {
+            .hidden = node->getUserFlag("hide"_spr),
+            .hasExtraChildren = node->getUserObject("extra-children"_spr) != nullptr
+        };
+    }
+    return it->second;
+}
+
+CCArray* DevTools::getExtraChildren(CCNode* node) {
+    if (!this->getNodeUserState(node).hasExtraChildren) {
+        return nullptr;
+    }
+    return typeinfo_cast<CCArray*>(node->getUserObject("extra-children"_spr));
+}
+
+void DevTools::buildTreeRows() {
+    m_treeDirty = false;
+
+    m_treeRows.clear();
+    m_treeRowNodes.clear();
+    m_treeScene = CCDirector::get()->getRunningScene();
+
+    this->buildTreeBranch(m_treeScene, 0, {});
+    this->buildTreeBranch(OverlayManager::get(), 1, {});
+}
+
+void DevTools::applySceneChanges() {
+    auto journal = SceneJournal::get();
+    bool complete = journal->forEachSince(m_journalGeneration, [&](SceneChange const& change) {
+        // rare enough to start over, the node may be gone already so it can't be looked up
+        if (change.type == SceneChangeType::SetUserObject || change.type == SceneChangeType::SetUserFlag) {
+            m_nodeUserStates.clear();
+        }
+        // rows read visibility and layouts when drawn, they don't need rebuilding for them
+        bool rowsChanged = change.type != SceneChangeType::SetVisible && change.type != SceneChangeType::SetLayout;
+        // only changes touching nodes we actually show need new rows
+        if (rowsChanged && !m_treeDirty && (m_treeRowNodes.contains(change.parent) || m_treeRowNodes.contains(change.node))) {
+            m_treeDirty = true;
+        }
+        // the index covers the whole scene but nothing that isn't attached to it, nor layouts
+        if (change.type == SceneChangeType::SetLayout) return;
+        if (!m_searchIndexDirty && !m_searchQuery.empty() && (m_searchIndex.contains(change.parent) || m_searchIndex.contains(change.node))) {
+            m_searchIndexDirty = true;
+        }
+    });
+    if (!complete) {
+        this->invalidateTree();
+    }
+    m_journalGeneration = journal->generation();
+}
+
+// Past this the arena is wiped along with every cached label, stale labels would otherwise pile up
+static constexpr size_t MAX_LABEL_ARENA_SIZE = 8 * 1024 * 1024;
+
+char const* DevTools::getTreeLabel(TreeRow const& row) {
+    CCNode* node = row.node;
+    auto& label = m_treeLabels[row.identity];
+    if (
+        label.text.data() &&
+        label.index == row.index &&
+        label.tag == node->getTag() &&
+        label.childCount == node->getChildrenCount() &&
+        label.fake == row.fake &&
+        label.flagHidden == row.flagHidden &&
+        label.id == node->getID()
+    ) {
+        return label.text.data();
+    }
+
+    if (m_labelArena.used() > MAX_LABEL_ARENA_SIZE) {
+        m_treeLabels.clear();
+        m_labelArena.reset();
+        return this->getTreeLabel(row);
+    }
+
+    static std::string buffer;
+    buffer.clear();
+    formatNodeNameTo(buffer, getNodeLabelParts(node, row.index, row.fake, row.flagHidden));
+
+    label = {
+        .id = m_labelArena.store(node->getID()),
+        .text = m_labelArena.store(buffer),
+        .index = row.index,
+        .tag = node->getTag(),
+        .childCount = node->getChildrenCount(),
+        .fake = row.fake,
+        .flagHidden = row.flagHidden
+    };
+    return label.text.data();
+}
+
+void DevTools::drawTreePageRow(size_t rowIndex) {
+    auto& row = m_treeRows[rowIndex];
+    CCNode* node = row.node;
+
+    if (node->getChildrenCount() != row.childCount) {
+        this->invalidateTree();
+    }
+
+    ImGui::SetNextItemOpen(this->isTreePageOpen(row.identity, row.index));
+
+    auto indent = row.depth * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0.f) ImGui::Indent(indent);
+
+    ImGui::PushID(node);
+    bool expanded = ImGui::TreeNodeEx(
+        reinterpret_cast<void*>(row.index), ImGuiTreeNodeFlags_NoTreePushOnOpen,
+        "[%zu..%zu]", row.pageStart, row.pageEnd - 1
+    );
+    ImGui::PopID();
+
+    if (indent > 0.f) ImGui::Unindent(indent);
+
+    if (ImGui::IsItemToggledOpen()) {
+        std::pair key { row.identity, row.index };
+        if (!m_searchQuery.empty()) {
+            if (expanded) m_searchCollapsedPages.erase(key);
+            else m_searchCollapsedPages.insert(key);
+        }
+        if (expanded) m_openPages.insert(key);
+        else m_openPages.erase(key);
+        m_treeDirty = true;
+    }
+}
+
+void DevTools::drawTreeRow(size_t rowIndex) {
+    auto& row = m_treeRows[rowIndex];
+    CCNode* node = row.node;
+    if (row.page) {
+        return this->drawTreePageRow(rowIndex);
+    }
+
+    // the scene changed under us, draw what we have and rebuild next frame
+    if ((!row.fake && node->getParent() != row.parent) || node->getChildrenCount() != row.childCount) {
+        this->invalidateTree();
+    }
 
-    auto selected = DevTools::get()->getSelectedNode() == node;
+    auto selected = this->isNodeSelected(node);
 
-    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_None;
+    ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_NoTreePushOnOpen;
     if (selected) {
         flags |= ImGuiTreeNodeFlags_Selected;
     }
@@ -70,7 +406,7 @@ void DevTools::drawTreeBranch(CCNode* node, size_t index, TreeBranchOptions opti
 
     bool drawSeparator = false;
 
-    if (auto dragged = this->getDraggedNode(); dragged && dragged != node && !options.drag && !options.fake) {
+    if (auto dragged = this->getDraggedNode(); dragged && dragged != node && !row.fake && !isNodeParentOf(dragged, node)) {
         float mouseY = ImGui::GetMousePos().y;
         float cursorY = ImGui::GetCursorPosY() + ImGui::GetWindowPos().y - ImGui::GetScrollY();
         float height = ImGui::GetTextLineHeight();
@@ -80,110 +416,119 @@ void DevTools::drawTreeBranch(CCNode* node, size_t index, TreeBranchOptions opti
             if (mouseY <= cursorY + height) {
                 flags |= ImGuiTreeNodeFlags_Selected;
 
-                if (!ImGui::IsMouseDown(ImGuiMouseButton_Left) && !isNodeParentOf(dragged, node)) {
+                if (!ImGui::IsMouseDown(ImGuiMouseButton_Left)) {
                     auto parent = dragged->getParent();
+                    auto before = EditJournal::capture(dragged, EditProperty::Move);
                     dragged->removeFromParentAndCleanup(false);
                     node->addChild(dragged);
+                    EditJournal::get()->record(dragged, EditProperty::Move, before, EditJournal::capture(dragged, EditProperty::Move));
                     parent->updateLayout();
                     node->updateLayout();
+                    this->invalidateTree();
                 }
             } else {
                 drawSeparator = true;
 
-                if (!ImGui::IsMouseDown(ImGuiMouseButton_Left) && !isNodeParentOf(dragged, node)) {
+                if (!ImGui::IsMouseDown(ImGuiMouseButton_Left)) {
                     // place the dragged node right after `node`
                     auto newParent = node->getParent();
                     if (newParent) {
                         auto oldParent = dragged->getParent();
+                        auto journal = EditJournal::get();
+                        // the siblings making room are undone along with the move
+                        journal->beginGroup();
+                        auto before = EditJournal::capture(dragged, EditProperty::Move);
                         auto children = newParent->getChildrenExt();
-                        for (int i = index + 1; i < children.size(); i++) {
-                            children[i]->m_uOrderOfArrival++;
+                        for (int i = row.index + 1; i < children.size(); i++) {
+                            auto sibling = children[i];
+                            auto siblingBefore = EditJournal::capture(sibling, EditProperty::OrderOfArrival);
+                            sibling->m_uOrderOfArrival++;
+                            journal->record(sibling, EditProperty::OrderOfArrival, siblingBefore, EditJournal::capture(sibling, EditProperty::OrderOfArrival));
                         }
                         dragged->removeFromParentAndCleanup(false);
                         newParent->addChild(dragged, node->getZOrder());
                         dragged->m_uOrderOfArrival = node->m_uOrderOfArrival + 1;
+                        journal->record(dragged, EditProperty::Move, before, EditJournal::capture(dragged, EditProperty::Move));
+                        journal->endGroup();
 
                         if (oldParent != newParent) oldParent->updateLayout();
                         newParent->updateLayout();
+                        this->invalidateTree();
                     }
                 }
             }
         }
     }
 
-    if (m_searchQuery.empty()) {
-        ImGui::SetNextItemOpen(m_nodeOpen.contains(node) && m_nodeOpen[node]);
-    }
-    else if (m_searchQuery != m_prevQuery) {
-        ImGui::SetNextItemOpen(true);
-    }
+    ImGui::SetNextItemOpen(this->isTreeNodeOpen(row.identity));
 
     auto alpha = ImGui::GetStyle().DisabledAlpha;
     ImGui::GetStyle().DisabledAlpha = node->isVisible() ? alpha + 0.15f : alpha;
 
-    ImGui::BeginDisabled(!options.visible);
+    ImGui::BeginDisabled(!this->isTreeRowVisible(rowIndex));
     ImGui::PushItemFlag(ImGuiItemFlags_Disabled, false); // Bypass iteract blocking in imgui
 
-    const auto name = formatNodeName(node, index, options.fake, options.flagHidden);
-    // The order here is unusual due to imgui weirdness; see the second-to-last paragraph in https://kahwei.dev/2022/06/20/imgui-tree-node/
-    bool expanded = ImGui::TreeNodeEx(node, flags, "%s", name.c_str());
+    auto indent = row.depth * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0.f) ImGui::Indent(indent);
+
+    bool expanded = ImGui::TreeNodeEx(node, flags, "%s", this->getTreeLabel(row));
     float height = ImGui::GetItemRectSize().y;
+    if (node == m_scrollToNode) {
+        ImGui::SetScrollHereY(0.5f);
+        m_scrollToNode = nullptr;
+    }
 
+    if (indent > 0.f) ImGui::Unindent(indent);
 
     ImGui::GetStyle().DisabledAlpha = alpha;
     ImGui::PopItemFlag(); //ImGuiItemFlags_Disabled
     ImGui::EndDisabled();
 
     if (ImGui::IsItemClicked()) {
-        DevTools::get()->selectNode(node);
+        auto& io = ImGui::GetIO();
+        if (io.KeyCtrl) {
+            this->toggleNodeSelected(node);
+        }
+        else if (io.KeyShift && m_selectedNode) {
+            this->selectTreeRange(rowIndex);
+        }
+        else {
+            this->selectNode(node);
+        }
         selected = true;
 
         if (!m_searchQuery.empty()) {
-            CCNode* parent = node->getParent();
-            while (parent) {
-                m_nodeOpen[parent] = true;
-                parent = parent->getParent();
-            }
+            this->expandToNode(node);
         }
     }
-    if (ImGui::IsItemToggledOpen() && (m_searchQuery.empty() || m_searchQuery == m_prevQuery)) {
-        if (!m_searchQuery.empty() && expanded) {
-            CCNode* parent = node->getParent();
-            while (parent) {
-                m_nodeOpen[parent] = true;
-                parent = parent->getParent();
+    if (ImGui::IsItemToggledOpen()) {
+        if (!m_searchQuery.empty()) {
+            if (expanded) {
+                m_searchCollapsed.erase(row.identity);
+                this->expandToNode(node);
+            }
+            else {
+                m_searchCollapsed.insert(row.identity);
             }
         }
-        m_nodeOpen[node] = expanded;
+        m_nodeOpen[row.identity] = expanded;
+        m_treeDirty = true;
     }
 
     if (ImGui::IsItemHovered() && (m_settings.alwaysHighlight || ImGui::IsKeyDown(ImGuiMod_Shift))) {
         DevTools::get()->highlightNode(node, HighlightMode::Hovered);
     }
 
-    bool isDrag = false;
-
     if (m_settings.treeDragReorder && ImGui::IsItemActive()) {
         if (ImGui::IsMouseDragging(ImGuiMouseButton_Left, height / 2.f)) {
-            isDrag = true;
             if (this->getDraggedNode() != node) {
                 this->setDraggedNode(node);
             }
         }
     }
 
-    if (expanded) {
-        if (m_settings.attributesInTree) {
-            this->drawNodeAttributes(node);
-        }
-
-        this->drawNodeChildren(node, {
-            .drag = options.drag || isDrag,
-            .visible = options.visible,
-            .flagHidden = false
-        });
-
-        ImGui::TreePop();
+    if (expanded && m_settings.attributesInTree) {
+        this->drawNodeAttributes(node);
     }
     // on leaf nodes expanded is true
     if (drawSeparator && (!expanded || !node->getChildrenCount())) {
@@ -191,47 +536,145 @@ void DevTools::drawTreeBranch(CCNode* node, size_t index, TreeBranchOptions opti
     }
 }
 
-void DevTools::drawNodeChildren(CCNode* node, ParentNodeInformation info) {
-    size_t i = 0;
-    for (auto& child : CCArrayExt<CCNode*>(node->getChildren())) {
-        this->drawTreeBranch(child, i++, {
-            .drag = info.drag,
-            .visible = info.visible,
-            .fake = false,
-            .flagHidden = info.flagHidden
-        });
-    }
-
-    i = 0;
-    if (auto fakeChildren = typeinfo_cast<CCArray*>(node->getUserObject("extra-children"_spr))) {
-        for (auto& child : CCArrayExt<CCNode*>(fakeChildren)) {
-            this->drawTreeBranch(child, i++, {
-                .drag = info.drag,
-                .visible = info.visible,
-                .fake = true,
-                .flagHidden = info.flagHidden
-            });
-        }
-    }
-}
-
 void DevTools::drawTree() {
 #ifdef GEODE_IS_MOBILE
     ImGui::Dummy({0.f, 60.f});
 #endif
-    m_prevQuery = m_searchQuery;
 
     auto space = ImGui::GetContentRegionAvail();
     auto height = ImGui::GetFrameHeight();
     ImGui::SetNextItemWidth(space.x - height);
     ImGui::InputTextWithHint("##search", U8STR(FEATHER_SEARCH " Search for a node..."), &m_searchQuery, ImGuiInputTextFlags_EnterReturnsTrue);
+    if (ImGui::IsItemHovered()) {
+        ImGui::SetTooltip(
+            "Searches class names and IDs. Filters can be combined:\n"
+            "  class:CCMenuItemSpriteExtra id:*-button tag:5 visible:true children>10\n"
+            "Use > for direct children and >> for any descendant:\n"
+            "  MenuLayer > CCMenu > *"
+        );
+    }
     ImGui::SameLine(0, 0);
     if (ImGui::Button(U8STR(FEATHER_X), ImVec2(height, height))) {
         m_searchQuery.clear();
     }
 
-    this->drawTreeBranch(CCDirector::get()->getRunningScene(), 0, { .drag = false });
-    this->drawTreeBranch(OverlayManager::get(), 1, { .drag = false });
+    if (ImGui::SmallButton(U8STR(FEATHER_CAMERA " Take Snapshot"))) {
+        this->takeSceneSnapshot();
+        m_showSceneDiff = true;
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton(U8STR(FEATHER_COLUMNS " Compare"))) {
+        m_showSceneDiff = true;
+        if (!m_sceneCaptures.empty()) {
+            this->compareSceneSnapshots();
+        }
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton(U8STR(FEATHER_HARD_DRIVE " Export"))) {
+        this->exportBinarySnapshot();
+    }
+    ImGui::SameLine();
+    if (ImGui::SmallButton(U8STR(FEATHER_FILE " Export JSON"))) {
+        async::spawn(
+            file::pick(file::PickMode::SaveFile, file::FilePickOptions {
+                .filters = {{ .description = "JSON File", .files = {"*.json"} }}
+            }),
+            [](Result<std::optional<std::filesystem::path>> result) {
+                if (result.isErr()) return;
+                auto file = std::move(result).unwrap();
+                if (!file) return;
+
+                auto path = *file;
+                if (path.extension() != ".json") {
+                    path += ".json";
+                }
+                // the scene may well have changed while the picker was open, export what's there now
+                auto error = exportNodeJson(CCDirector::get()->getRunningScene(), path);
+                if (!error.empty()) {
+                    log::error("Failed to export tree to {}: {}", string::pathToString(path), error);
+                }
+            }
+        );
+    }
+
+    this->compactNodeState(false);
+    this->applySceneChanges();
+    if (m_treeScene != CCDirector::get()->getRunningScene()) {
+        this->invalidateTree();
+    }
+    if (m_searchQuery != m_prevQuery) {
+        m_prevQuery = m_searchQuery;
+        m_searchCollapsed.clear();
+        m_searchCollapsedPages.clear();
+        m_searchError.clear();
+        m_compiledQuery = NodeQuery::parse(m_searchQuery, &m_searchError).value_or(NodeQuery());
+        m_searchResultIndex = 0;
+        // the running search is for the old query, the next one replaces it
+        m_searchPending = false;
+        this->invalidateTree();
+    }
+    // a scene that changes every frame would otherwise keep cancelling its own searches
+    if (m_searchIndexDirty && !m_searchPending) {
+        this->buildSearchIndex();
+    }
+    this->applySearchResult();
+
+    if (!m_searchError.empty()) {
+        ImGui::TextColored(ImVec4(1.f, .4f, .4f, 1.f), "%s", m_searchError.c_str());
+    }
+    else if (!m_searchQuery.empty()) {
+        if (m_searchPending) {
+            ImGui::Text("%zu matches (searching...)", m_searchResults.size());
+        }
+        else {
+            ImGui::Text("%zu matches", m_searchResults.size());
+        }
+        if (!m_searchResults.empty()) {
+            ImGui::SameLine();
+            if (ImGui::SmallButton(U8STR(FEATHER_CHEVRON_UP "##prevmatch"))) {
+                this->selectSearchResult(m_searchResultIndex + m_searchResults.size() - 1);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton(U8STR(FEATHER_CHEVRON_DOWN "##nextmatch"))) {
+                this->selectSearchResult(m_searchResultIndex + 1);
+            }
+            ImGui::SameLine();
+            if (ImGui::SmallButton(U8STR(FEATHER_CHECK_SQUARE " Select All##selectmatches"))) {
+                this->selectSearchResults();
+            }
+        }
+    }
+
+    if (m_treeDirty) {
+        this->buildTreeRows();
+    }
+
+    // inline attributes make rows uneven, which the clipper can't deal with
+    if (m_settings.attributesInTree) {
+        for (size_t i = 0; i < m_treeRows.size(); i++) {
+            this->drawTreeRow(i);
+        }
+    }
+    else {
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(m_treeRows.size()));
+        if (m_scrollToNode) {
+            auto it = std::find_if(m_treeRows.begin(), m_treeRows.end(), [&](auto const& row) {
+                return !row.page && row.node.data() == m_scrollToNode;
+            });
+            if (it != m_treeRows.end()) {
+                clipper.IncludeItemByIndex(static_cast<int>(it - m_treeRows.begin()));
+            }
+            else {
+                m_scrollToNode = nullptr;
+            }
+        }
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++) {
+                this->drawTreeRow(i);
+            }
+        }
+    }
 
     if (auto* dragged = this->getDraggedNode()) {
         const auto name = formatNodeName(dragged, 0, false, false);
@@ -254,21 +697,101 @@ void DevTools::drawTree() {
 bool DevTools::searchBranch(CCNode* node) {
     if (m_searchQuery.empty()) return true;
 
-    std::string name(geode::cocos::getObjectName(node));
-    std::string id = node->getID();
-    std::string query = m_searchQuery;
+    auto it = m_searchIndex.find(node);
+    return it != m_searchIndex.end() && it->second;
+}
 
-    utils::string::toLowerIP(name);
-    utils::string::toLowerIP(id);
-    utils::string::toLowerIP(query);
+void DevTools::snapshotSearchBranch(CCNode* node, size_t parent, SceneSnapshot& snapshot) {
+    if (!node) return;
+    // also guards against fake children forming a cycle
+    if (!m_snapshotSeen.insert(node).second) return;
 
-    if (name.find(query) != std::string::npos || id.find(query) != std::string::npos) {
-        return true;
-    }
+    auto index = snapshot.nodes.size();
+    snapshot.add(
+        node, NodeRegistry::get()->identify(node), parent,
+        getObjectClassNameLower(node), node->getID(), node->getTag(),
+        node->isVisible(), node->getChildrenCount()
+    );
+
+    // every child has to be visited, the index covers the whole scene
     for (auto child : node->getChildrenExt<CCNode>()) {
-        if (searchBranch(child)) {
-            return true;
+        this->snapshotSearchBranch(child, index, snapshot);
+    }
+    if (auto fakeChildren = this->getExtraChildren(node)) {
+        for (auto child : CCArrayExt<CCNode*>(fakeChildren)) {
+            this->snapshotSearchBranch(child, index, snapshot);
         }
     }
-    return false;
+}
+
+void DevTools::buildSearchIndex() {
+    m_searchIndexDirty = false;
+    if (m_searchQuery.empty() || !m_searchError.empty()) {
+        SearchWorker::get()->cancel();
+        m_searchPending = false;
+        m_searchIndex.clear();
+        m_searchResults.clear();
+        return;
+    }
+
+    // only the copy is made here, the matching happens on the worker thread
+    SceneSnapshot snapshot;
+    snapshot.nodes.reserve(m_searchIndex.size());
+    m_snapshotSeen.clear();
+    this->snapshotSearchBranch(CCDirector::get()->getRunningScene(), SceneSnapshot::NO_PARENT, snapshot);
+    this->snapshotSearchBranch(OverlayManager::get(), SceneSnapshot::NO_PARENT, snapshot);
+    m_snapshotSeen.clear();
+
+    m_searchGeneration = SceneJournal::get()->generation();
+    m_searchRequest = SearchWorker::get()->submit(m_compiledQuery, std::move(snapshot));
+    m_searchPending = true;
+}
+
+void DevTools::applySearchResult() {
+    if (!m_searchPending) return;
+    auto result = SearchWorker::get()->poll(m_searchRequest);
+    if (!result) return;
+    m_searchPending = false;
+
+    auto registry = NodeRegistry::get();
+    auto& nodes = result->snapshot.nodes;
+    m_searchIndex.clear();
+    m_searchIndex.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); i++) {
+        // the pointers are only compared against, a dead node simply never shows up again
+        m_searchIndex[nodes[i].node] = result->subtreeMatched[i];
+    }
+
+    // the scene kept going while the worker ran, skip whatever died in the meantime
+    m_searchResults.clear();
+    for (auto i : result->matches) {
+        if (auto node = registry->find(nodes[i].identity)) {
+            m_searchResults.push_back(node);
+        }
+    }
+    if (m_searchResultIndex >= m_searchResults.size()) {
+        m_searchResultIndex = 0;
+    }
+    m_treeDirty = true;
+
+    // catch up on what changed while the worker was busy
+    bool complete = SceneJournal::get()->forEachSince(m_searchGeneration, [&](SceneChange const& change) {
+        if (change.type == SceneChangeType::SetLayout) return;
+        if (m_searchIndex.contains(change.parent) || m_searchIndex.contains(change.node)) {
+            m_searchIndexDirty = true;
+        }
+    });
+    if (!complete) {
+        m_searchIndexDirty = true;
+    }
+}
+
+void DevTools::selectSearchResult(size_t index) {
+    if (m_searchResults.empty()) return;
+    m_searchResultIndex = index % m_searchResults.size();
+
+    auto node = m_searchResults[m_searchResultIndex].data();
+    this->selectNode(node);
+    this->expandToNode(node);
+    m_scrollToNode = node;
 }
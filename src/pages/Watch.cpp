@@ -0,0 +1,172 @@
+#include "../fonts/FeatherIcons.hpp"
+#include "../DevTools.hpp"
+#include "../platform/utils.hpp"
+#include <cfloat>
+
+using namespace geode::prelude;
+
+// same order as WatchKind
+static constexpr std::array<char const*, 8> WATCH_KIND_NAMES = {
+    "Position X",
+    "Position Y",
+    "Scale X",
+    "Scale Y",
+    "Rotation",
+    "Opacity",
+    "Width",
+    "Height",
+};
+
+static std::optional<float> readWatchedValue(CCNode* node, WatchKind kind) {
+    switch (kind) {
+        case WatchKind::PositionX: return node->getPositionX();
+        case WatchKind::PositionY: return node->getPositionY();
+        case WatchKind::ScaleX: return node->getScaleX();
+        case WatchKind::ScaleY: return node->getScaleY();
+        case WatchKind::Rotation: return node->getRotation();
+        case WatchKind::Opacity: {
+            if (auto rgba = typeinfo_cast<CCRGBAProtocol*>(node)) {
+                return static_cast<float>(rgba->getOpacity());
+            }
+            return std::nullopt;
+        }
+        case WatchKind::Width: return node->getContentWidth();
+        case WatchKind::Height: return node->getContentHeight();
+        // sampled by the property itself while it's being drawn
+        case WatchKind::Property: return std::nullopt;
+    }
+    return std::nullopt;
+}
+
+void DevTools::addWatch(CCNode* node, WatchKind kind, std::string_view property) {
+    auto identity = NodeRegistry::get()->identify(node);
+    for (auto& watch : m_watches) {
+        if (watch->node == identity && watch->kind == kind && watch->property == property) {
+            m_showWatch = true;
+            return;
+        }
+    }
+
+    auto watch = std::make_unique<WatchedValue>();
+    watch->node = identity;
+    watch->kind = kind;
+    watch->property = property;
+    watch->label = fmt::format(
+        "{} {}",
+        getObjectClassName(node),
+        kind == WatchKind::Property ? property : std::string_view(WATCH_KIND_NAMES[static_cast<size_t>(kind)])
+    );
+    if (!node->getID().empty()) {
+        watch->label += fmt::format(" ({})", node->getID());
+    }
+    m_watches.push_back(std::move(watch));
+    m_showWatch = true;
+}
+
+void DevTools::watchProperty(std::string_view name, float value) {
+    auto node = m_attributesNode;
+    if (!node) return;
+
+    if (ImGui::BeginPopupContextItem()) {
+        if (ImGui::MenuItem(U8STR(FEATHER_EYE " Watch"))) {
+            this->addWatch(node, WatchKind::Property, name);
+        }
+        ImGui::EndPopup();
+    }
+
+    if (m_watches.empty()) return;
+    auto identity = NodeRegistry::get()->identify(node);
+    for (auto& watch : m_watches) {
+        if (watch->kind == WatchKind::Property && watch->node == identity && watch->property == name) {
+            watch->push(value);
+        }
+    }
+}
+
+void DevTools::drawWatchMenu(CCNode* node, std::initializer_list<WatchKind> kinds) {
+    if (ImGui::BeginPopupContextItem()) {
+        for (auto kind : kinds) {
+            auto label = fmt::format("{} Watch {}", U8STR(FEATHER_EYE), WATCH_KIND_NAMES[static_cast<size_t>(kind)]);
+            if (ImGui::MenuItem(label.c_str())) {
+                this->addWatch(node, kind);
+            }
+        }
+        ImGui::EndPopup();
+    }
+}
+
+void DevTools::sampleWatches() {
+    auto registry = NodeRegistry::get();
+    for (auto& watch : m_watches) {
+        if (auto node = registry->find(watch->node)) {
+            if (auto value = readWatchedValue(node, watch->kind)) {
+                watch->push(*value);
+            }
+        }
+    }
+}
+
+void DevTools::drawWatch() {
+    if (m_selectedNode) {
+        ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x * 0.5f);
+        ImGui::Combo("##newwatch", &m_newWatchKind, WATCH_KIND_NAMES.data(), static_cast<int>(WATCH_KIND_NAMES.size()));
+        ImGui::SameLine();
+        if (ImGui::Button(U8STR(FEATHER_PLUS " Watch Selected"))) {
+            this->addWatch(m_selectedNode, static_cast<WatchKind>(m_newWatchKind));
+        }
+    }
+    else {
+        ImGui::TextWrapped("Select a node to watch its attributes, or right click one in the Attributes page");
+    }
+
+    if (m_watches.empty()) return;
+    ImGui::SameLine();
+    if (ImGui::Button(U8STR(FEATHER_TRASH_2 " Clear"))) {
+        m_watches.clear();
+        return;
+    }
+
+    ImGui::Separator();
+
+    auto registry = NodeRegistry::get();
+    auto width = ImGui::GetContentRegionAvail().x;
+    std::optional<size_t> removed;
+    for (size_t i = 0; i < m_watches.size(); i++) {
+        auto& watch = *m_watches[i];
+        ImGui::PushID(&watch);
+
+        auto alive = registry->find(watch.node) != nullptr;
+        if (!alive) {
+            ImGui::TextDisabled("%s (destroyed)", watch.label.c_str());
+        }
+        else {
+            ImGui::TextUnformatted(watch.label.c_str());
+        }
+        ImGui::SameLine();
+        if (ImGui::SmallButton(watch.paused ? U8STR(FEATHER_PLAY " Resume") : U8STR(FEATHER_PAUSE " Pause"))) {
+            watch.paused = !watch.paused;
+        }
+        ImGui::SameLine();
+        if (ImGui::SmallButton(U8STR(FEATHER_X))) {
+            removed = i;
+        }
+
+        auto last = watch.count ? watch.samples[(watch.next + WatchedValue::HISTORY - 1) % WatchedValue::HISTORY] : 0.f;
+        auto overlay = fmt::format("{:.3f}", last);
+        // once the buffer wraps around the oldest sample is the one about to be overwritten
+        ImGui::PlotLines(
+            "##plot",
+            watch.samples.data(),
+            static_cast<int>(watch.count),
+            watch.count == WatchedValue::HISTORY ? static_cast<int>(watch.next) : 0,
+            overlay.c_str(),
+            FLT_MAX, FLT_MAX,
+            ImVec2(width, 60.f)
+        );
+
+        ImGui::PopID();
+    }
+    if (removed) {
+        m_watches.erase(m_watches.begin() + *removed);
+    }
+}
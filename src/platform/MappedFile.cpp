@@ -0,0 +1,119 @@
+#include "MappedFile.hpp"
+#include <utility>
+
+#ifdef GEODE_IS_WINDOWS
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        this->close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+#ifdef GEODE_IS_WINDOWS
+        m_file = std::exchange(other.m_file, nullptr);
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+#else
+        m_fd = std::exchange(other.m_fd, -1);
+#endif
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    this->close();
+}
+
+bool MappedFile::isOpen() const {
+    return m_data != nullptr;
+}
+
+std::span<uint8_t const> MappedFile::data() const {
+    return { m_data, m_size };
+}
+
+#ifdef GEODE_IS_WINDOWS
+
+void MappedFile::close() {
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mapping) CloseHandle(m_mapping);
+    if (m_file && m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+    m_data = nullptr;
+    m_size = 0;
+    m_mapping = nullptr;
+    m_file = nullptr;
+}
+
+MappedFile MappedFile::open(std::filesystem::path const& path, std::string* error) {
+    MappedFile ret;
+    auto fail = [&](char const* what) {
+        if (error) *error = what;
+        ret.close();
+        return std::move(ret);
+    };
+
+    ret.m_file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (ret.m_file == INVALID_HANDLE_VALUE) {
+        return fail("Unable to open file");
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(ret.m_file, &size) || size.QuadPart == 0) {
+        return fail("File is empty");
+    }
+    ret.m_mapping = CreateFileMappingW(ret.m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!ret.m_mapping) {
+        return fail("Unable to map file");
+    }
+    ret.m_data = static_cast<uint8_t const*>(MapViewOfFile(ret.m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (!ret.m_data) {
+        return fail("Unable to map file");
+    }
+    ret.m_size = static_cast<size_t>(size.QuadPart);
+    return ret;
+}
+
+#else
+
+void MappedFile::close() {
+    if (m_data) munmap(const_cast<uint8_t*>(m_data), m_size);
+    if (m_fd >= 0) ::close(m_fd);
+    m_data = nullptr;
+    m_size = 0;
+    m_fd = -1;
+}
+
+MappedFile MappedFile::open(std::filesystem::path const& path, std::string* error) {
+    MappedFile ret;
+    auto fail = [&](char const* what) {
+        if (error) *error = what;
+        ret.close();
+        return std::move(ret);
+    };
+
+    ret.m_fd = ::open(path.c_str(), O_RDONLY);
+    if (ret.m_fd < 0) {
+        return fail("Unable to open file");
+    }
+    struct stat info;
+    if (fstat(ret.m_fd, &info) != 0 || info.st_size == 0) {
+        return fail("File is empty");
+    }
+    auto data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, ret.m_fd, 0);
+    if (data == MAP_FAILED) {
+        return fail("Unable to map file");
+    }
+    ret.m_data = static_cast<uint8_t const*>(data);
+    ret.m_size = static_cast<size_t>(info.st_size);
+    return ret;
+}
+
+#endif
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <Geode/platform/platform.hpp>
+
+// Read-only memory mapping of a whole file
+class MappedFile final {
+private:
+    uint8_t const* m_data = nullptr;
+    size_t m_size = 0;
+#ifdef GEODE_IS_WINDOWS
+    void* m_file = nullptr;
+    void* m_mapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+
+    void close();
+
+public:
+    MappedFile() = default;
+    MappedFile(MappedFile const&) = delete;
+    MappedFile& operator=(MappedFile const&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    // Returns an empty mapping and fills `error` if the file can't be mapped
+    static MappedFile open(std::filesystem::path const& path, std::string* error = nullptr);
+
+    bool isOpen() const;
+    std::span<uint8_t const> data() const;
+};
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+// Helpers for poking at arbitrary memory in the Memory page without crashing.
+// Only canReadAddr, read_ptr32 and the RTTI/string layouts are platform specific.
+// Nothing here depends on Geode, what little it needs to know about the game is
+// handed over with setMemoryScanContext.
+
+struct MemoryScanContext {
+    // where the game and cocos are loaded, MSVC RTTI uses 32-bit offsets from them
+    uintptr_t gameBase = 0;
+    uintptr_t cocosBase = 0;
+    // data of an empty gd::string, which all of them share on Android
+    char const* emptyStdString = nullptr;
+};
+
+void setMemoryScanContext(MemoryScanContext const& context);
+
+// Whether `size` bytes starting at `addr` are mapped and readable
+bool canReadAddr(uintptr_t addr, size_t size);
+
+struct SafePtr {
+    uintptr_t addr = 0;
+    SafePtr(uintptr_t addr) : addr(addr) {}
+    SafePtr(const void* addr) : addr(reinterpret_cast<uintptr_t>(addr)) {}
+
+    bool operator==(void* ptr) const { return as_ptr() == ptr; }
+    // breaks clang
+    // operator bool() const { return addr != 0; }
+
+    void* as_ptr() const { return reinterpret_cast<void*>(addr); }
+
+    bool is_safe(int size) {
+        return addr % 4 == 0 && canReadAddr(addr, size);
+    }
+
+    bool read_into(void* buffer, int size) {
+        if (!is_safe(size)) return false;
+
+        std::memcpy(buffer, as_ptr(), size);
+        return true;
+    }
+
+    template <class T>
+    T read() {
+        T result{};
+        read_into(&result, sizeof(result));
+        return result;
+    }
+
+    template <class T>
+    std::optional<T> read_opt() {
+        T result;
+        if (!read_into(&result, sizeof(result))) return std::nullopt;
+        return result;
+    }
+
+    SafePtr read_ptr() {
+        return SafePtr(this->read<uintptr_t>());
+    }
+
+    // read offset relative to base as a 32-bit int
+    SafePtr read_ptr32();
+
+    SafePtr operator+(intptr_t offset) const {
+        return SafePtr(addr + offset);
+    }
+    SafePtr operator-(intptr_t offset) const {
+        return SafePtr(addr - offset);
+    }
+
+    std::string_view read_c_str(int max_size = 512) {
+        if (!is_safe(max_size)) return "";
+        auto* c_str = reinterpret_cast<const char*>(as_ptr());
+        for (int i = 0; i < max_size; ++i) {
+            if (c_str[i] == 0)
+                return std::string_view(c_str, i);
+        }
+        return "";
+    }
+};
+
+std::string_view demangle(std::string_view mangled);
+
+struct RttiInfo {
+    SafePtr ptr;
+    RttiInfo(SafePtr ptr) : ptr(ptr) {}
+
+    std::optional<std::string_view> class_name();
+};
+
+// The string at `ptr`, if it looks like a std::string of the platform's standard library
+std::optional<std::string_view> findStdString(SafePtr ptr);
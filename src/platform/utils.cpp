@@ -6,7 +6,10 @@
 #include <OpenGLES/ES2/gl.h>
 #endif
 #include <unordered_map>
+#include <typeindex>
 #include <cocos2d.h>
+#include <Geode/utils/cocos.hpp>
+#include <Geode/utils/string.hpp>
 
 using namespace cocos2d;
 
@@ -26,6 +29,29 @@ std::string formatAddressIntoOffset(uintptr_t addr, bool module) {
     }
 }
 
+struct ClassNames {
+    std::string name;
+    std::string lower;
+};
+
+static ClassNames const& getClassNames(CCObject* obj) {
+    static std::unordered_map<std::type_index, ClassNames> names;
+    auto& entry = names[typeid(*obj)];
+    if (entry.name.empty()) {
+        entry.name = geode::cocos::getObjectName(obj);
+        entry.lower = geode::utils::string::toLower(entry.name);
+    }
+    return entry;
+}
+
+std::string_view getObjectClassName(CCObject* obj) {
+    return getClassNames(obj).name;
+}
+
+std::string_view getObjectClassNameLower(CCObject* obj) {
+    return getClassNames(obj).lower;
+}
+
 std::vector<uint8_t> renderToBytes(CCNode* node, int& width, int& height) {
     // Get scale from cocos2d units to opengl units
     GLint viewport[4];
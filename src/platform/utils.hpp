@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <stdint.h>
 #include <Geode/cocos/cocoa/CCObject.h>
 
@@ -8,5 +9,10 @@ std::string formatAddressIntoOffset(uintptr_t addr, bool module);
 
 std::string formatAddressIntoOffsetImpl(uintptr_t addr, bool module);
 
+// Demangled class name of an object, cached per dynamic type
+std::string_view getObjectClassName(cocos2d::CCObject* obj);
+// Same as getObjectClassName but lowercased, for case insensitive searching
+std::string_view getObjectClassNameLower(cocos2d::CCObject* obj);
+
 std::vector<uint8_t> renderToBytes(cocos2d::CCNode* node, int& width, int& height);
 void saveRenderToFile(std::vector<uint8_t> const& data, int width, int height, char const* filename);